@@ -18,13 +18,8 @@ const HcalCalibrationWidths& HcalCalibrationWidthsSet::getCalibrationWidths(cons
 
 void HcalCalibrationWidthsSet::setCalibrationWidths(DetId fId, const HcalCalibrationWidths& ca) {
   DetId fId2(hcalTransformedId(fId));
-  auto cell = mItems.find(fId2);
-  if (cell==mItems.end()) {
-    auto result = mItems.emplace(fId2,fId2);
-    result.first->second.calib=ca;
-    return;
-  }
-  cell->second.calib=ca;
+  auto result = mItems.try_emplace(fId2,fId2);
+  result.first->second.calib=ca;
 }
 
 void HcalCalibrationWidthsSet::clear() {
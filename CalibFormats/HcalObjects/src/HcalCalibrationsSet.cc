@@ -18,13 +18,8 @@ const HcalCalibrations& HcalCalibrationsSet::getCalibrations(const DetId fId) co
 
 void HcalCalibrationsSet::setCalibrations(DetId fId, const HcalCalibrations& ca) {
   DetId fId2(hcalTransformedId(fId));
-  auto cell = mItems.find(fId2);
-  if (cell==mItems.end()) {
-    auto result = mItems.emplace(fId2,fId2);
-    result.first->second.calib=ca;
-    return;
-  }
-  cell->second.calib=ca;
+  auto result = mItems.try_emplace(fId2,fId2);
+  result.first->second.calib=ca;
 }
 
 void HcalCalibrationsSet::clear() {
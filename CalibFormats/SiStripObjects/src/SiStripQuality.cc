@@ -492,7 +492,7 @@ void SiStripQuality::subtraction(std::vector<unsigned int>& A,const unsigned int
       tmp.push_back(*jt);
     }
   } 
-  A=tmp;
+  A.swap(tmp);
 }
 
 bool SiStripQuality::cleanUp(bool force)
@@ -502,13 +502,13 @@ bool SiStripQuality::cleanUp(bool force)
 
   toCleanUp=false;
 
-  std::vector<unsigned int> v_badstrips_tmp=v_badstrips;
-  std::vector<DetRegistry> indexes_tmp=indexes;
-
   LogTrace("SiStripQuality") << "[SiStripQuality::cleanUp] before cleanUp v_badstrips.size()= " << v_badstrips.size() << " indexes.size()=" << indexes.size() << std::endl;
 
-  v_badstrips.clear();
-  indexes.clear();
+  // take over the current content, the containers are refilled below
+  std::vector<unsigned int> v_badstrips_tmp;
+  std::vector<DetRegistry> indexes_tmp;
+  v_badstrips_tmp.swap(v_badstrips);
+  indexes_tmp.swap(indexes);
 
   SiStripBadStrip::RegistryIterator basebegin = indexes_tmp.begin();
   SiStripBadStrip::RegistryIterator baseend   = indexes_tmp.end();
@@ -521,6 +521,10 @@ bool SiStripQuality::cleanUp(bool force)
     }
   }
   
+  // the object lives for the whole IOV, do not keep the growth slack
+  v_badstrips.shrink_to_fit();
+  indexes.shrink_to_fit();
+
   LogTrace("SiStripQuality") << "[SiStripQuality::cleanUp] after cleanUp v_badstrips.size()= " << v_badstrips.size() << " indexes.size()=" << indexes.size() << std::endl;
   return true;
 }
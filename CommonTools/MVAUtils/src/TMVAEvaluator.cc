@@ -89,8 +89,9 @@ float TMVAEvaluator::evaluateTMVA(const std::map<std::string, float>& inputs, bo
 
     // set the input variable values
     for (auto it = mVariables.begin(); it != mVariables.end(); ++it) {
-        if (inputs.count(it->first) > 0)
-            it->second.second = inputs.at(it->first);
+        auto input = inputs.find(it->first);
+        if (input != inputs.end())
+            it->second.second = input->second;
         else
             edm::LogError("MissingInputVariable")
                 << "Input variable " << it->first
@@ -101,8 +102,9 @@ float TMVAEvaluator::evaluateTMVA(const std::map<std::string, float>& inputs, bo
     if (useSpectators) {
         // set the spectator variable values
         for (auto it = mSpectators.begin(); it != mSpectators.end(); ++it) {
-            if (inputs.count(it->first) > 0)
-                it->second.second = inputs.at(it->first);
+            auto input = inputs.find(it->first);
+            if (input != inputs.end())
+                it->second.second = input->second;
             else
                 edm::LogError("MissingSpectatorVariable")
                     << "Spectator variable " << it->first
@@ -125,8 +127,9 @@ float TMVAEvaluator::evaluateGBRForest(const std::map<std::string, float>& input
 
     // set the input variable values
     for (auto it = mVariables.begin(); it != mVariables.end(); ++it) {
-        if (inputs.count(it->first) > 0)
-            vars[it->second.first] = inputs.at(it->first);
+        auto input = inputs.find(it->first);
+        if (input != inputs.end())
+            vars[it->second.first] = input->second;
         else
             edm::LogError("MissingInputVariable")
                 << "Input variable " << it->first
@@ -87,9 +87,10 @@ double PuppiContainer::var_within_R(int iId, const vector<PuppiCandidate> & part
     vector<double > near_dR2s;     near_dR2s.reserve(std::min(50UL, particles.size()));
     vector<double > near_pts;      near_pts.reserve(std::min(50UL, particles.size()));
     const double r2 = R*R;
+    const double centreRap = centre.rap();
     for (auto const& part : particles){
       //squared_distance is in (y,phi) coords: rap() has faster access -> check it first
-      if ( std::abs(part.rap()-centre.rap()) < R && part.squared_distance(centre) < r2 ){
+      if ( std::abs(part.rap()-centreRap) < R && part.squared_distance(centre) < r2 ){
         near_dR2s.push_back(reco::deltaR2(part, centre));
         near_pts.push_back(part.pt());
       }
@@ -141,12 +142,16 @@ void PuppiContainer::getRMSAvg(int iOpt,std::vector<PuppiCandidate> const &iCons
         
         // // fPuppiAlgo[pPupId].add(iConstits[i0],pVal,iOpt);
         //code added by Nhan, now instead for every algorithm give it all the particles
+        //the metric only depends on (algoId, isCharged, coneSize): algos sharing them reuse one value
+        const int    lPupAlgo    = pAlgo;
+        const bool   lPupCharged = pCharged;
+        const double lPupCone    = pCone;
         for(int i1 = 0; i1 < fNAlgos; i1++){
             pAlgo    = fPuppiAlgo[i1].algoId   (iOpt);
             pCharged = fPuppiAlgo[i1].isCharged(iOpt);
             pCone    = fPuppiAlgo[i1].coneSize (iOpt);
             double curVal = -1; 
-            if (i1 != pPupId){
+            if (i1 != pPupId && (pAlgo != lPupAlgo || pCharged != lPupCharged || pCone != lPupCone)){
               if(!pCharged) curVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone);
               if( pCharged) curVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone);
             } else {//no need to repeat the computation
@@ -89,6 +89,9 @@ void
 MethodInvoker::
 setArgs()
 {
+  // args_ points into ints_, so rebuild it from scratch on every (re)assignment
+  args_.clear();
+  args_.reserve(ints_.size());
   for (size_t i = 0; i < ints_.size(); ++i) {
     args_.push_back(boost::apply_visitor(AnyMethodArgument2VoidPtr(), ints_[i]));
   }
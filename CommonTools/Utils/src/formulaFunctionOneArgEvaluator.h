@@ -20,7 +20,6 @@
 
 // system include files
 #include <memory>
-#include <functional>
 
 // user include files
 #include "formulaEvaluatorBase.h"
@@ -54,7 +53,8 @@ namespace reco {
       
       // ---------- member data --------------------------------
       std::shared_ptr<EvaluatorBase> m_arg;
-      std::function<double(double)> m_function;
+      //all functions are capture-less lambdas, a plain pointer avoids the std::function dispatch
+      double (*m_function)(double);
     };
   }
 }
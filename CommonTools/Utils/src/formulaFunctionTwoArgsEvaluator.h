@@ -20,7 +20,6 @@
 
 // system include files
 #include <memory>
-#include <functional>
 
 // user include files
 #include "formulaEvaluatorBase.h"
@@ -64,7 +63,7 @@ namespace reco {
       // ---------- member data --------------------------------
       std::shared_ptr<EvaluatorBase> m_arg1;
       std::shared_ptr<EvaluatorBase> m_arg2;
-      std::function<double(double,double)> m_function;
+      double (*m_function)(double,double);
     };
   }
 }
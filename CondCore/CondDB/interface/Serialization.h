@@ -82,9 +82,6 @@ namespace cond {
                                                                 const Binary& payloadData,
                                                                 const Binary& streamerInfoData ){
     std::unique_ptr<T> payload;
-    std::stringbuf sstreamerInfoBuf;
-    sstreamerInfoBuf.pubsetbuf( static_cast<char*>(const_cast<void*>(streamerInfoData.data())), streamerInfoData.size() );
-    std::string streamerInfo = sstreamerInfoBuf.str();
     try{
       std::stringbuf sdataBuf;
       sdataBuf.pubsetbuf( static_cast<char*>(const_cast<void*>(payloadData.data())), payloadData.size() );
@@ -103,6 +100,8 @@ namespace cond {
       } else {
 	errorMsg += em;
       }
+      // the serialization info is only needed for the error report
+      std::string streamerInfo( static_cast<const char*>(streamerInfoData.data()), streamerInfoData.size() );
       if( !streamerInfo.empty() ) errorMsg += " Payload serialization info: "+streamerInfo;
       throwException( errorMsg, "default_deserialize" );
     }
@@ -31,7 +31,14 @@ namespace cond {
 
     void BasePayloadProxy::reload(){
       std::string tag = m_iovProxy.tag();
-      if( !tag.empty() ) loadTag( tag );
+      if( tag.empty() ) return;
+      m_session.transaction().start(true);
+      m_iovProxy = m_session.readIov( tag );
+      m_session.transaction().commit();
+      // payloads are immutable: the one already loaded is kept, and re-used by make()
+      // if the refreshed iov sequence still points to the same hash
+      m_currentIov.clear();
+      m_requests.clear();
     }
     
     ValidityInterval BasePayloadProxy::setIntervalFor(cond::Time_t time, bool load) {
@@ -386,9 +386,9 @@ CondDBESSource::setIntervalFor( const edm::eventsetup::EventSetupRecordKey& iKey
   cond::TimeType timetype = cond::TimeType::invalid;
   bool userTime=true;
 
- //FIXME use equal_range
-  ProxyMap::const_iterator pmBegin = m_proxies.lower_bound(recordname);
-  ProxyMap::const_iterator pmEnd = m_proxies.upper_bound(recordname);
+  std::pair<ProxyMap::const_iterator,ProxyMap::const_iterator> pmRange = m_proxies.equal_range(recordname);
+  ProxyMap::const_iterator pmBegin = pmRange.first;
+  ProxyMap::const_iterator pmEnd = pmRange.second;
   if ( pmBegin == pmEnd ) {
     edm::LogInfo( "CondDBESSource" ) << "No DataProxy (Pluging) found for record \""<< recordname
 				     << "\"; from CondDBESSource::setIntervalFor";
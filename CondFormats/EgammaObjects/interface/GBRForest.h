@@ -29,6 +29,8 @@
        GBRForest();
        
        double GetResponse(const float* vector) const;
+       // evaluate n objects at once, walking each tree for all of them before moving to the next
+       void GetResponse(const float* const* vectors, double* responses, unsigned int n) const;
        double GetGradBoostClassifier(const float* vector) const;
        double GetAdaBoostClassifier(const float* vector) const { return GetResponse(vector); }
        
@@ -58,6 +60,14 @@ inline double GBRForest::GetResponse(const float* vector) const {
   return response;
 }
 
+//_______________________________________________________________________
+inline void GBRForest::GetResponse(const float* const* vectors, double* responses, unsigned int n) const {
+  for (unsigned int i=0; i<n; ++i) responses[i] = fInitialResponse;
+  for (std::vector<GBRTree>::const_iterator it=fTrees.begin(); it!=fTrees.end(); ++it) {
+    for (unsigned int i=0; i<n; ++i) responses[i] += it->GetResponse(vectors[i]);
+  }
+}
+
 //_______________________________________________________________________
 inline double GBRForest::GetGradBoostClassifier(const float* vector) const {
   double response = GetResponse(vector);
@@ -0,0 +1,61 @@
+#include "CondFormats/EgammaObjects/interface/GBRForest.h"
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Checks that the batched GBRForest::GetResponse gives bit-identical
+// results to evaluating each object on its own.
+
+namespace {
+  // A complete tree of the given depth with random cuts on nVars variables.
+  GBRTree makeTree(std::mt19937& rng, int depth, int nVars) {
+    const int nIntermediate = (1 << depth) - 1;
+    const int nTerminal = 1 << depth;
+    GBRTree tree(nIntermediate, nTerminal);
+    std::uniform_int_distribution<int> var(0, nVars - 1);
+    std::uniform_real_distribution<float> val(-1.f, 1.f);
+    for (int i = 0; i < nIntermediate; ++i) {
+      tree.CutIndices().push_back(var(rng));
+      tree.CutVals().push_back(val(rng));
+      // daughters beyond the intermediate nodes are terminal, stored as minus their index
+      const int left = 2 * i + 1, right = 2 * i + 2;
+      tree.LeftIndices().push_back(left < nIntermediate ? left : -(left - nIntermediate));
+      tree.RightIndices().push_back(right < nIntermediate ? right : -(right - nIntermediate));
+    }
+    for (int i = 0; i < nTerminal; ++i) tree.Responses().push_back(val(rng));
+    return tree;
+  }
+}
+
+int main() {
+  const int nVars = 5;
+  const unsigned int nObjects = 257;
+
+  std::mt19937 rng(12345);
+  GBRForest forest;
+  forest.SetInitialResponse(0.25);
+  for (int i = 0; i < 100; ++i) forest.Trees().push_back(makeTree(rng, 1 + i % 6, nVars));
+
+  std::uniform_real_distribution<float> val(-1.2f, 1.2f);
+  std::vector<std::vector<float>> inputs(nObjects, std::vector<float>(nVars));
+  std::vector<const float*> vectors;
+  for (auto& input : inputs) {
+    for (auto& x : input) x = val(rng);
+    vectors.push_back(input.data());
+  }
+
+  std::vector<double> batched(nObjects);
+  forest.GetResponse(vectors.data(), batched.data(), nObjects);
+
+  int failures = 0;
+  for (unsigned int i = 0; i < nObjects; ++i) {
+    const double single = forest.GetResponse(vectors[i]);
+    if (batched[i] != single) {
+      std::cerr << "object " << i << ": batched response " << batched[i]
+                << " differs from single response " << single << std::endl;
+      ++failures;
+    }
+  }
+  return failures == 0 ? 0 : 1;
+}
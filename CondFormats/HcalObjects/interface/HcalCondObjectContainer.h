@@ -272,6 +272,8 @@ HcalCondObjectContainer<Item>::addValues(const Item& myItem) {
 template<class Item> std::vector<DetId>
 HcalCondObjectContainer<Item>::getAllChannels() const {
   std::vector<DetId> channels;
+  channels.reserve(HBcontainer.size()+HEcontainer.size()+HOcontainer.size()+HFcontainer.size()+
+                   HTcontainer.size()+ZDCcontainer.size()+CALIBcontainer.size()+CASTORcontainer.size());
   Item emptyItem;
   for (unsigned int i=0; i<HBcontainer.size(); i++) {
     if (emptyItem.rawId() != HBcontainer.at(i).rawId() )
@@ -319,6 +319,7 @@ std::vector<float> FactorizedJetCorrectorCalculator::fillVector(const std::vecto
 {
 //  std::vector<VarTypes> fVarTypes = _fVarTypes;
   std::vector<float> result;
+  result.reserve(fVarTypes.size());
   for(unsigned i=0;i<fVarTypes.size();i++) {
     if (fVarTypes[i] == kJetEta) {
       if (!iValues.mIsJetEtaset)
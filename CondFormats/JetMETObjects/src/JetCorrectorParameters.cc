@@ -203,8 +203,11 @@ int JetCorrectorParameters::binIndex(const std::vector<float>& fX) const
     {
       tmp = 0;
       for (unsigned j=0;j<N;j++)
-        if (fX[j] >= record(i).xMin(j) && fX[j] < record(i).xMax(j))
+        {
+          if (!(fX[j] >= record(i).xMin(j) && fX[j] < record(i).xMax(j)))
+            break;
           tmp+=1;
+        }
       if (tmp==N)
         {
           result = i;
@@ -606,6 +606,16 @@ private:
   using QCMap = std::map<std::string, QCriterion*>;
   using QAMap = std::map<std::string, QCriterion* (*)(std::string const&)>;
 
+  MEMap::const_iterator lowerBoundObject(uint32_t run,
+                                         uint32_t lumi,
+                                         uint32_t moduleId,
+                                         std::string const& dir,
+                                         std::string const& name,
+                                         bool& found) const;
+  MonitorElement* findObjectForBooking(std::string const& dir,
+                                       std::string const& name,
+                                       MEMap::const_iterator& hint);
+
   // ------------------------ private I/O helpers ------------------------------
   void saveMonitorElementToPB(MonitorElement const& me,
                               dqmstorepb::ROOTFilePB& file);
@@ -418,20 +418,24 @@ void
 DQMNet::sendObjectToPeer(Bucket *msg, Object &o, bool data)
 {
   uint32_t flags = o.flags & ~DQM_PROP_DEAD;
-  DataBlob objdata;
 
+  // Point at the payload in place rather than staging a copy of it,
+  // the message buffer below is the only copy needed.
+  const void *objdata = nullptr;
+  uint32_t datalen = 0;
   if ((flags & DQM_PROP_TYPE_MASK) <= DQM_PROP_TYPE_SCALAR)
-    objdata.insert(objdata.end(),
-		   &o.scalar[0],
-		   &o.scalar[0] + o.scalar.size());
+  {
+    objdata = o.scalar.data();
+    datalen = o.scalar.size();
+  }
   else if (data)
-    objdata.insert(objdata.end(),
-		   &o.rawdata[0],
-		   &o.rawdata[0] + o.rawdata.size());
+  {
+    objdata = o.rawdata.data();
+    datalen = o.rawdata.size();
+  }
 
   uint32_t words [9];
   uint32_t namelen = o.dirname->size() + o.objname.size() + 1;
-  uint32_t datalen = objdata.size();
   uint32_t qlen = o.qdata.size();
 
   if (o.dirname->empty())
@@ -457,7 +461,7 @@ DQMNet::sendObjectToPeer(Bucket *msg, Object &o, bool data)
     copydata(msg, &o.objname[0], o.objname.size());
   }
   if (datalen)
-    copydata(msg, &objdata[0], datalen);
+    copydata(msg, objdata, datalen);
   if (qlen)
     copydata(msg, &o.qdata[0], qlen);
 }
@@ -911,8 +911,10 @@ DQMStore::book_(std::string const& dir,
   // Put us in charge of h.
   h->SetDirectory(nullptr);
 
-  // Check if the request monitor element already exists.
-  MonitorElement* me = findObject(run_, 0, moduleId_, dir, name);
+  // Check if the request monitor element already exists; if not, remember
+  // where it has to be inserted so that data_ is searched only once.
+  MEMap::const_iterator mepos;
+  MonitorElement* me = findObjectForBooking(dir, name, mepos);
   if (me) {
     if (collateHistograms_) {
       collate(me, h, verbose_);
@@ -932,9 +934,10 @@ DQMStore::book_(std::string const& dir,
   }
   else {
     // Create and initialise core object.
-    assert(dirs_.count(dir));
-    MonitorElement proto(&*dirs_.find(dir), name, run_, moduleId_);
-    me = const_cast<MonitorElement&>(*data_.insert(std::move(proto)).first)
+    auto dirpos = dirs_.find(dir);
+    assert(dirpos != dirs_.end());
+    MonitorElement proto(&*dirpos, name, run_, moduleId_);
+    me = const_cast<MonitorElement&>(*data_.emplace_hint(mepos, std::move(proto)))
       .initialise((MonitorElement::Kind)kind, h);
 
     // Initialise quality test information.
@@ -951,7 +954,8 @@ DQMStore::book_(std::string const& dir,
     refdir += s_referenceDirName;
     refdir += '/';
     refdir += dir;
-    MonitorElement* referenceME = findObject(0, 0, 0, refdir, name);
+    // A reference MonitorElement can only exist if its directory does.
+    MonitorElement* referenceME = dirs_.count(refdir) ? findObject(0, 0, 0, refdir, name) : nullptr;
     if (referenceME) {
       // We have booked a new MonitorElement with a specific dir and name.
       // Then, if we can find the corresponding MonitorElement in the reference
@@ -976,7 +980,8 @@ DQMStore::book_(std::string const& dir,
     print_trace(dir, name);
 
   // Check if the request monitor element already exists.
-  if (MonitorElement* me = findObject(run_, 0, moduleId_, dir, name)) {
+  MEMap::const_iterator mepos;
+  if (MonitorElement* me = findObjectForBooking(dir, name, mepos)) {
     if (verbose_ > 1) {
       std::string path;
       mergePath(path, dir, name);
@@ -990,9 +995,10 @@ DQMStore::book_(std::string const& dir,
   }
   else {
     // Create it and return for initialisation.
-    assert(dirs_.count(dir));
-    MonitorElement proto(&*dirs_.find(dir), name, run_, moduleId_);
-    return &const_cast<MonitorElement&>(*data_.insert(std::move(proto)).first);
+    auto dirpos = dirs_.find(dir);
+    assert(dirpos != dirs_.end());
+    MonitorElement proto(&*dirpos, name, run_, moduleId_);
+    return &const_cast<MonitorElement&>(*data_.emplace_hint(mepos, std::move(proto)));
   }
 }
 
@@ -1638,6 +1644,8 @@ DQMStore::getContents(std::string const& path) const
   for ( ; i != e && isSubdirectory(*cleaned, *i->data_.dirname); ++i)
     if (*cleaned == *i->data_.dirname)
       result.push_back(const_cast<MonitorElement *>(&*i));
+    else if (! enableMultiThread_)
+      break; // single (run, module) block: the rest are subfolders
 
   return result;
 }
@@ -1655,10 +1663,13 @@ DQMStore::getContents(std::string const& path, unsigned int const tag) const
   auto e = data_.end();
   auto i = data_.lower_bound(proto);
   for ( ; i != e && isSubdirectory(*cleaned, *i->data_.dirname); ++i)
-    if (*cleaned == *i->data_.dirname
-        && (i->data_.flags & DQMNet::DQM_PROP_TAGGED)
-        && i->data_.tag == tag)
-      result.push_back(const_cast<MonitorElement *>(&*i));
+    if (*cleaned == *i->data_.dirname) {
+      if ((i->data_.flags & DQMNet::DQM_PROP_TAGGED)
+          && i->data_.tag == tag)
+        result.push_back(const_cast<MonitorElement *>(&*i));
+    }
+    else if (! enableMultiThread_)
+      break; // single (run, module) block: the rest are subfolders
 
   return result;
 }
@@ -1687,6 +1698,8 @@ DQMStore::getContents(std::vector<std::string>& into, bool const showContents /*
         sz += m->data_.objname.size() + 1;
         ++nfound;
       }
+      else if (! enableMultiThread_)
+        break; // single (run, module) block: the rest are subfolders
 
     if (! nfound)
       continue;
@@ -1721,14 +1734,15 @@ DQMStore::getContents(std::vector<std::string>& into, bool const showContents /*
   }
 }
 
-/// get MonitorElement <name> in directory <dir>
-/// (null if MonitorElement does not exist)
-MonitorElement*
-DQMStore::findObject(uint32_t const run,
-                     uint32_t const lumi,
-                     uint32_t const moduleId,
-                     std::string const& dir,
-                     std::string const& name) const
+/// position of MonitorElement <name> in directory <dir> in data_, or of
+/// where it should be inserted; found is set if it exists
+DQMStore::MEMap::const_iterator
+DQMStore::lowerBoundObject(uint32_t const run,
+                           uint32_t const lumi,
+                           uint32_t const moduleId,
+                           std::string const& dir,
+                           std::string const& name,
+                           bool& found) const
 {
   if (dir.find_first_not_of(s_safe) != std::string::npos)
     raiseDQMError("DQMStore", "Monitor element path name '%s' uses"
@@ -1744,9 +1758,36 @@ DQMStore::findObject(uint32_t const run,
   proto.data_.lumi     = lumi;
   proto.data_.moduleId = moduleId;
 
-  auto mepos = data_.find(proto);
-  return (mepos == data_.end() ? nullptr
-          : const_cast<MonitorElement *>(&*mepos));
+  auto mepos = data_.lower_bound(proto);
+  found = (mepos != data_.end() && !(proto < *mepos));
+  return mepos;
+}
+
+/// get MonitorElement <name> in directory <dir>
+/// (null if MonitorElement does not exist)
+MonitorElement*
+DQMStore::findObject(uint32_t const run,
+                     uint32_t const lumi,
+                     uint32_t const moduleId,
+                     std::string const& dir,
+                     std::string const& name) const
+{
+  bool found;
+  auto mepos = lowerBoundObject(run, lumi, moduleId, dir, name, found);
+  return (found ? const_cast<MonitorElement *>(&*mepos) : nullptr);
+}
+
+/// same as findObject for the MonitorElement being booked (current run_ and
+/// moduleId_, lumi 0); if it does not exist, hint is set to the position
+/// where it should be inserted in data_
+MonitorElement*
+DQMStore::findObjectForBooking(std::string const& dir,
+                               std::string const& name,
+                               MEMap::const_iterator& hint)
+{
+  bool found;
+  hint = lowerBoundObject(run_, 0, moduleId_, dir, name, found);
+  return (found ? const_cast<MonitorElement *>(&*hint) : nullptr);
 }
 
 /// get vector with children of folder, including all subfolders + their children;
@@ -2857,6 +2898,8 @@ DQMStore::readDirectory(TFile* file,
 /// if prepend !="", prepend string to path
 /// note: by default this method keeps the dir structure as in file
 /// and does not update monitor element references!
+/// protobuf (.pb) files only support the onlypath selection: asking
+/// for overwrite, prepend or stripdirs on them raises an error
 bool
 DQMStore::open(std::string const& filename,
                bool const overwrite /* = false */,
@@ -2865,6 +2908,12 @@ DQMStore::open(std::string const& filename,
                OpenRunDirs const stripdirs /* =KeepRunDirs */,
                bool const fileMustExist /* =true */)
 {
+  if (s_rxpbfile.match(filename, 0, 0)) {
+    if (overwrite || ! prepend.empty() || stripdirs != KeepRunDirs)
+      raiseDQMError("DQMStore", "Cannot open protobuf file '%s' with overwrite,"
+                    " prepend or stripdirs, only onlypath is supported", filename.c_str());
+    return readFilePB(filename,overwrite,onlypath,prepend,stripdirs,fileMustExist);
+  }
   return readFile(filename,overwrite,onlypath,prepend,stripdirs,fileMustExist);
 }
 
@@ -3023,6 +3072,15 @@ DQMStore::readFilePB(std::string const& filename,
 
     TObject* obj = nullptr;
     dqmstorepb::ROOTFilePB::Histo const& h = dqmstore_message.histo(i);
+
+    // skip the objects outside of onlypath before paying for their de-serialisation
+    if (! onlypath.empty()) {
+      size_t slash = h.full_pathname().rfind('/');
+      path.assign(h.full_pathname(), 0, (slash == std::string::npos ? 0 : slash));
+      if (! isSubdirectory(onlypath, path))
+        continue;
+    }
+
     get_info(h, path, objname, &obj);
 
     setCurrentFolder(path);
@@ -47,6 +47,14 @@
 #include "format.h"
 
 namespace {
+  //same as MonitorElement::getFullname() but re-uses the storage of the branch buffer
+  void fillFullName(std::string& oFullName, MonitorElement const* iElement) {
+    const std::string& path = iElement->getPathname();
+    oFullName.assign(path);
+    if(not path.empty()) { oFullName += '/';}
+    oFullName += iElement->getName();
+  }
+
   class TreeHelperBase {
   public:
     TreeHelperBase(): m_wasFilled(false), m_firstIndex(0),m_lastIndex(0) {}
@@ -76,7 +84,7 @@ namespace {
     TreeHelper(TTree* iTree, std::string* iFullNameBufferPtr ):
      m_tree(iTree), m_flagBuffer(0),m_fullNameBufferPtr(iFullNameBufferPtr){ setup();}
      void doFill(MonitorElement* iElement) override {
-       *m_fullNameBufferPtr = iElement->getFullname();
+       fillFullName(*m_fullNameBufferPtr, iElement);
        m_flagBuffer = iElement->getTag();
        m_bufferPtr = dynamic_cast<T*>(iElement->getRootObject());
        assert(nullptr!=m_bufferPtr);
@@ -106,7 +114,7 @@ namespace {
      {setup();}
 
     void doFill(MonitorElement* iElement) override {
-     *m_fullNameBufferPtr = iElement->getFullname();
+     fillFullName(*m_fullNameBufferPtr, iElement);
      m_flagBuffer = iElement->getTag();
      m_buffer = iElement->getIntValue();
      m_tree->Fill();
@@ -130,7 +138,7 @@ namespace {
      m_tree(iTree), m_flagBuffer(0),m_fullNameBufferPtr(iFullNameBufferPtr)
      {setup();}
    void doFill(MonitorElement* iElement) override {
-     *m_fullNameBufferPtr = iElement->getFullname();
+     fillFullName(*m_fullNameBufferPtr, iElement);
      m_flagBuffer = iElement->getTag();
      m_buffer = iElement->getFloatValue();
      m_tree->Fill();
@@ -154,7 +162,7 @@ namespace {
      m_tree(iTree), m_flagBuffer(0),m_fullNameBufferPtr(iFullNameBufferPtr), m_bufferPtr(&m_buffer)
      {setup();}
    void doFill(MonitorElement* iElement) override {
-     *m_fullNameBufferPtr = iElement->getFullname();
+     fillFullName(*m_fullNameBufferPtr, iElement);
      m_flagBuffer = iElement->getTag();
      m_buffer = iElement->getStringValue();
      m_tree->Fill();
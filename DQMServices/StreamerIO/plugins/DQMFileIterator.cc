@@ -189,7 +189,7 @@ void DQMFileIterator::monUpdateLumi(const LumiEntry& lumi) {
 std::time_t DQMFileIterator::mtimeHash() const {
   std::time_t mtime_now = 0;
   
-  for (auto path : runPath_) {
+  for (auto const& path : runPath_) {
     if (!boost::filesystem::exists(path))
       continue;
 
@@ -231,7 +231,10 @@ void DQMFileIterator::collect(bool ignoreTimers) {
 
   std::string fn_eor;
 
-  for (auto runPath : runPath_) {
+  // compiled once per scan, not once per directory entry
+  const boost::regex fn_re("run(\\d+)_ls(\\d+)_([a-zA-Z0-9]+)(_.*)?\\.jsn");
+
+  for (auto const& runPath : runPath_) {
     if (!boost::filesystem::exists(runPath)) {
       logFileAction("Directory does not exist: ", runPath);
 
@@ -240,15 +243,14 @@ void DQMFileIterator::collect(bool ignoreTimers) {
 
     directory_iterator dend;
     for (directory_iterator di(runPath); di != dend; ++di) {
-      const boost::regex fn_re("run(\\d+)_ls(\\d+)_([a-zA-Z0-9]+)(_.*)?\\.jsn");
-
       const std::string filename = di->path().filename().string();
-      const std::string fn = di->path().string();
 
       if (filesSeen_.find(filename) != filesSeen_.end()) {
         continue;
       }
 
+      const std::string fn = di->path().string();
+
       boost::smatch result;
       if (boost::regex_match(filename, result, fn_re)) {
         unsigned int run = std::stoi(result[1]);
@@ -24,6 +24,7 @@
 #include <cassert>
 #include <cstddef>
 #include <algorithm>
+#include <utility>
 
 // user include files
 #include "DataFormats/Common/interface/RefProd.h"
@@ -38,6 +39,7 @@ namespace edm {
    public:
       ContainerMask() {}
       ContainerMask(const edm::RefProd<T>& iProd, const std::vector<bool>& iMask);
+      ContainerMask(const edm::RefProd<T>& iProd, std::vector<bool>&& iMask);
       //virtual ~ContainerMask();
 
       // ---------- const member functions ---------------------
@@ -78,6 +80,12 @@ namespace edm {
    m_prod(iProd), m_mask(iMask) {
       assert(iMask.size() <= ContainerMaskTraits<T>::size(m_prod.product()));
    }
+
+   template<typename T>
+   ContainerMask<T>::ContainerMask(const edm::RefProd<T>& iProd, std::vector<bool>&& iMask):
+   m_prod(iProd), m_mask(std::move(iMask)) {
+      assert(m_mask.size() <= ContainerMaskTraits<T>::size(m_prod.product()));
+   }
    
    
    template<typename T>
@@ -254,19 +254,19 @@ namespace edm {
   DetSetVector<T>::find_or_insert(det_id_type id) {
     // NOTE: we don't have to clear _alreadySorted: the new DS is empty, 
     //       and gets inserted in the correct place
-    std::pair<iterator,iterator> p =
-      std::equal_range(_sets.begin(), _sets.end(), id);
+    // A single binary search gives both the match, if any, and the
+    // insertion point.
+    iterator it = std::lower_bound(_sets.begin(), _sets.end(), id);
 
-    // If the range isn't empty, we already have the right thing;
-    // return a reference to it...
-    if (p.first != p.second) return *p.first;
+    // If we already have the right thing, return a reference to it...
+    if (it != _sets.end() && !(id < *it)) return *it;
 
     // Insert the right thing, in the right place, and return a
     // reference to the newly inserted thing.
 #if defined( __GXX_EXPERIMENTAL_CXX0X__)
-    return *(_sets.emplace(p.first, id));
+    return *(_sets.emplace(it, id));
 #else
-    return *(_sets.insert(p.first, detset(id)));
+    return *(_sets.insert(it, detset(id)));
 #endif
   }
 
@@ -289,32 +289,29 @@ namespace edm {
   typename DetSetVector<T>::iterator
   DetSetVector<T>::find(det_id_type id) {
     _alreadySorted = false; // it's non const 
-    std::pair<iterator,iterator> p =
-      std::equal_range(_sets.begin(), _sets.end(), id);
-    if (p.first == p.second) return _sets.end();
-
-    // The range indicated by [p.first, p.second) should be exactly of
-    // length 1. It seems likely we don't want to take the time hit of
-    // checking this, but here is the appropriate test... We can turn
-    // it on if we need the debugging aid.
+    iterator it = std::lower_bound(_sets.begin(), _sets.end(), id);
+    if (it == _sets.end() || id < *it) return _sets.end();
+
+    // The element at 'it' should be the only one with this id. It
+    // seems likely we don't want to take the time hit of checking
+    // this, but here is the appropriate test... We can turn it on if
+    // we need the debugging aid.
     #if 0
-    assert(std::distance(p.first, p.second) == 1);
+    assert(std::next(it) == _sets.end() || id < *std::next(it));
     #endif
 
-    return p.first;
+    return it;
   }
 
   template <class T>
   inline
   typename DetSetVector<T>::const_iterator
   DetSetVector<T>::find(det_id_type id) const {
-    std::pair<const_iterator,const_iterator> p =
-      std::equal_range(_sets.begin(), _sets.end(), id);
-    if (p.first == p.second) return _sets.end();
-    // The range indicated by [p.first, p.second) should be exactly of
-    // length 1.
-    assert(std::distance(p.first, p.second) == 1);
-    return p.first;
+    const_iterator it = std::lower_bound(_sets.begin(), _sets.end(), id);
+    if (it == _sets.end() || id < *it) return _sets.end();
+    // The element at 'it' should be the only one with this id.
+    assert(std::next(it) == _sets.end() || id < *std::next(it));
+    return it;
   }
 
   template <class T>
@@ -185,11 +185,12 @@ namespace edm {
   PtrVector<T>::fillView(std::vector<void const*>& pointers,
                          FillViewHelperVector& helpers) const {
     pointers.reserve(this->size());
+    helpers.reserve(this->size());
     for (const_iterator i = begin(), e = end(); i != e; ++i) {
       Ptr<T> ref = *i;
       T const* address = ref.isNull() ? nullptr : &*ref;
       pointers.push_back(address);
-      helpers.push_back(FillViewHelperVector::value_type(ref.id(),ref.key()));
+      helpers.emplace_back(ref.id(),ref.key());
     }
   }
 
@@ -358,6 +358,10 @@ namespace edm {
   void
   SortedCollection<T, SORT>::sort() {
     key_compare  comp;
+    // Producers usually fill in detector order: if the keys are already
+    // strictly increasing the sort would be the identity, so skip it.
+    if (std::adjacent_find(obj.begin(), obj.end(),
+                           [&comp](T const& a, T const& b) { return !comp(a, b); }) == obj.end()) return;
     std::sort(obj.begin(), obj.end(), comp);
   }
 
@@ -42,11 +42,12 @@ namespace edm {
 	  ProductID id = j->first;
 	  ++j;
 	  size_t max = (j == end ? size : j->second);
-	  typename value_map::iterator f = values_.find(id);
-	  if(f!=values_.end()) throwAdd();
-	  value_vector & values = values_.insert(std::make_pair(id, value_vector())).first->second;
-	  while(i!=max)
-	    values.push_back( map.values_[i++] );
+	  std::pair<typename value_map::iterator, bool> r = values_.insert(std::make_pair(id, value_vector()));
+	  if(!r.second) throwAdd();
+	  value_vector & values = r.first->second;
+	  values.insert(values.end(), map.values_.begin() + i, map.values_.begin() + max);
+	  totSize_ += max - i;
+	  i = max;
 	} while(j != end);
       }
       template<typename H, typename I>
@@ -54,9 +55,10 @@ namespace edm {
 	ProductID id = h.id();
 	size_t size = h->size(), sizeIt = end - begin;
 	if(sizeIt!=size) throwFillSize();
-	typename value_map::const_iterator f = values_.find(id);
-	if(f != values_.end()) throwFillID(id);
-	value_vector & values = values_.insert(make_pair(id, value_vector(size))).first->second;
+	std::pair<typename value_map::iterator, bool> r = values_.insert(std::make_pair(id, value_vector()));
+	if(!r.second) throwFillID(id);
+	value_vector & values = r.first->second;
+	values.resize(size);
 	std::copy(begin, end, values.begin());
         totSize_+=size;
       }
@@ -69,10 +71,8 @@ namespace edm {
 	  ProductID id = i->first;
 	  map_.ids_.push_back(std::make_pair(id, off));
 	  const value_vector & values = i->second;
-	  for(typename value_vector::const_iterator j = values.begin(); j != values.end(); ++j) {
-	    map_.values_.push_back( *j );
-	    ++off;
-	  }
+	  map_.values_.insert(map_.values_.end(), values.begin(), values.end());
+	  off += values.size();
 	}
         map_.shrink_to_fit();
       }
@@ -20,6 +20,9 @@ namespace edm {
 
   void DataFrameContainer::sort() {
     if (size()<2) return;
+    // nothing to do if the ids are already strictly increasing
+    if (std::adjacent_find(m_ids.begin(), m_ids.end(),
+                           [](id_type a, id_type b) { return !(a < b); }) == m_ids.end()) return;
     std::vector<int> indices(size(),1);
     indices[0]=0;
     std::partial_sum(indices.begin(),indices.end(),indices.begin());
@@ -36,3 +36,9 @@ void FEDRawData::resize(size_t newsize) {
 
   if (newsize%8!=0) throw cms::Exception("DataCorrupt") << "FEDRawData::resize: " << newsize << " is not a multiple of 8 bytes." << endl;
 }
+
+void FEDRawData::assign(const unsigned char * newdata, size_t newsize) {
+  if (newsize%8!=0) throw cms::Exception("DataCorrupt") << "FEDRawData::assign: " << newsize << " is not a multiple of 8 bytes." << endl;
+
+  data_.assign(newdata, newdata+newsize);
+}
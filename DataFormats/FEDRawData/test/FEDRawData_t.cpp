@@ -8,6 +8,7 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 #include <DataFormats/FEDRawData/interface/FEDRawData.h>
+#include <FWCore/Utilities/interface/Exception.h>
 
 #include <iostream>
 
@@ -17,6 +18,7 @@ class testFEDRawData: public CppUnit::TestFixture {
 
   CPPUNIT_TEST(testCtor);
   CPPUNIT_TEST(testdata);
+  CPPUNIT_TEST(testassign);
  
   CPPUNIT_TEST_SUITE_END();
 
@@ -27,6 +29,7 @@ public:
   void tearDown(){}  
   void testCtor();
   void testdata(); 
+  void testassign();
  
 }; 
 
@@ -56,5 +59,17 @@ void testFEDRawData::testdata(){
   CPPUNIT_ASSERT(buf[47] == 'c');
 }
 
+void testFEDRawData::testassign(){
+  unsigned char buf[16];
+  for (unsigned int i=0; i<sizeof(buf); ++i) buf[i]=i;
+
+  FEDRawData f(48);
+  f.assign(buf, sizeof(buf));
+  CPPUNIT_ASSERT(f.size()==sizeof(buf));
+  for (unsigned int i=0; i<sizeof(buf); ++i) CPPUNIT_ASSERT(f.data()[i]==i);
+
+  CPPUNIT_ASSERT_THROW(f.assign(buf, 12), cms::Exception);
+}
+
 
 #include <Utilities/Testing/interface/CppUnit_testdriver.icpp>
@@ -20,6 +20,8 @@
 #include "TTree.h"
 #include "TROOT.h"
 
+#include <algorithm>
+
 namespace fwlite {
 //
 // constants, enums and typedefs
@@ -120,14 +122,11 @@ ChainEvent::to(Long64_t iIndex)
 
    Long64_t offsetIndex = eventIndex_;
 
-   // we're going backwards, so start from the beginning
-   if (iIndex < accumulatedSize_[offsetIndex]) {
-      offsetIndex = 0;
-   }
-
-   // is it past the end of this file?
-   while (iIndex >= accumulatedSize_[offsetIndex+1]) {
-      ++offsetIndex;
+   // is it outside of this file? accumulatedSize_ is strictly increasing
+   // since empty files are skipped, so look up the file directly
+   if (iIndex < accumulatedSize_[offsetIndex] || iIndex >= accumulatedSize_[offsetIndex+1]) {
+      offsetIndex = std::max<Long64_t>(0, std::upper_bound(accumulatedSize_.begin(), accumulatedSize_.end(), iIndex)
+                                          - accumulatedSize_.begin() - 1);
    }
 
    if(offsetIndex != eventIndex_) {
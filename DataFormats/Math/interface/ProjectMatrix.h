@@ -42,6 +42,15 @@ struct ProjectMatrix{
     return r;
   }
   
+  // S*H^T (the columns of a symmetric S selected by H)
+  SMatND rproject(ROOT::Math::SMatrix<T,N,N,ROOT::Math::MatRepSym<T,N> > const & s) const {
+    SMatND r;
+    for (unsigned int i=0; i<N; i++)
+      for (unsigned int j=0; j<D; j++)
+	r(i,j) = s(i,index[j]);
+    return r;
+  }
+
   // K*H
   SMatNN project(SMatND const & k) const {
     SMatNN s;
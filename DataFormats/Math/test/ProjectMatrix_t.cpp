@@ -1,5 +1,6 @@
 #include "DataFormats/Math/interface/ProjectMatrix.h"
 #include <functional>
+#include <cassert>
 
 
 
@@ -62,6 +63,22 @@ int main() {
   }
 
 
+  {
+
+    double c[15] = {1., 0.1, 2., 0.2, 0.3, 3., 0.4, 0.5, 0.6, 4., 0.7, 0.8, 0.9, 1.1, 5.};
+    SMat55 C(c,15);
+    ProjectMatrix<double,5,2> H; H.index[0]=3; H.index[1]=4;
+    SMatND K1 = C*ROOT::Math::Transpose(H.matrix());
+    SMatND K2 = H.rproject(C);
+
+    std::cout << K1 << std::endl;
+    std::cout << K2 << std::endl;
+    std::cout << std::endl;
+    assert(K1==K2);
+
+  }
+
+
   return 0;
   
 }
@@ -11,10 +11,11 @@ CovarianceParameterization pat::PackedCandidate::covarianceParameterization_;
 std::once_flag pat::PackedCandidate::covariance_load_flag;
 
 void pat::PackedCandidate::pack(bool unpackAfterwards) {
-    packedPt_  =  MiniFloatConverter::float32to16(p4_.load()->Pt());
-    packedEta_ =  int16_t(std::round(p4_.load()->Eta()/6.0f*std::numeric_limits<int16_t>::max()));
-    packedPhi_ =  int16_t(std::round(p4_.load()->Phi()/3.2f*std::numeric_limits<int16_t>::max()));
-    packedM_   =  MiniFloatConverter::float32to16(p4_.load()->M());
+    const PolarLorentzVector * p4 = p4_.load();
+    packedPt_  =  MiniFloatConverter::float32to16(p4->Pt());
+    packedEta_ =  int16_t(std::round(p4->Eta()/6.0f*std::numeric_limits<int16_t>::max()));
+    packedPhi_ =  int16_t(std::round(p4->Phi()/3.2f*std::numeric_limits<int16_t>::max()));
+    packedM_   =  MiniFloatConverter::float32to16(p4->M());
     if (unpackAfterwards) {
       delete p4_.exchange(nullptr);
       delete p4c_.exchange(nullptr);
@@ -25,14 +26,16 @@ void pat::PackedCandidate::pack(bool unpackAfterwards) {
 void pat::PackedCandidate::packVtx(bool unpackAfterwards) {
     reco::VertexRef pvRef = vertexRef();
     Point pv = pvRef.isNonnull() ? pvRef->position() : Point();
-    float dxPV = vertex_.load()->X() - pv.X(), dyPV = vertex_.load()->Y() - pv.Y(); //, rPV = std::hypot(dxPV, dyPV);
-    float s = std::sin(float(p4_.load()->Phi())+dphi_), c = std::cos(float(p4_.load()->Phi()+dphi_)); // not the fastest option, but we're in reduced precision already, so let's avoid more roundoffs
+    const PolarLorentzVector * p4 = p4_.load();
+    const Point * vertex = vertex_.load();
+    float dxPV = vertex->X() - pv.X(), dyPV = vertex->Y() - pv.Y(); //, rPV = std::hypot(dxPV, dyPV);
+    float s = std::sin(float(p4->Phi())+dphi_), c = std::cos(float(p4->Phi()+dphi_)); // not the fastest option, but we're in reduced precision already, so let's avoid more roundoffs
     dxy_  = - dxPV * s + dyPV * c;    
     // if we want to go back to the full x,y,z we need to store also
     // float dl = dxPV * c + dyPV * s; 
     // float xRec = - dxy_ * s + dl * c, yRec = dxy_ * c + dl * s;
-    float pzpt = p4_.load()->Pz()/p4_.load()->Pt();
-    dz_ = vertex_.load()->Z() - pv.Z() - (dxPV*c + dyPV*s) * pzpt;
+    float pzpt = p4->Pz()/p4->Pt();
+    dz_ = vertex->Z() - pv.Z() - (dxPV*c + dyPV*s) * pzpt;
     packedDxy_ = MiniFloatConverter::float32to16(dxy_*100);
     packedDz_   = pvRef.isNonnull() ? MiniFloatConverter::float32to16(dz_*100) : int16_t(std::round(dz_/40.f*std::numeric_limits<int16_t>::max()));
     packedDPhi_ =  int16_t(std::round(dphi_/3.2f*std::numeric_limits<int16_t>::max()));
@@ -89,10 +89,12 @@ DDName::registerName( const std::pair<std::string, std::string> & nm )
     idToName.emplace_back( reg.begin());
     ++sz;
   }
-  Registry::value_type val( nm, sz );
-  std::pair<Registry::iterator, bool> result = reg.insert( val );
-  if( result.second ) {
-    idToName.emplace_back( result.first );
+  // only copy the name strings into the registry when they are new
+  Registry::iterator it = reg.lower_bound( nm );
+  if( it != reg.end() && !reg.key_comp()( nm, it->first )) {
+    return it;
   }
-  return result.first;
+  it = reg.emplace_hint( it, nm, sz );
+  idToName.emplace_back( it );
+  return it;
 }
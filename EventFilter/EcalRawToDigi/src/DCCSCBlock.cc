@@ -215,7 +215,8 @@ int DCCSCBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalID){
     short firstGainWrong=-1;
     short numGainWrong=0;
     
-    for (unsigned int i=1; i<nTSamples_; i++ ) {
+    // stop at the first wrong transition: only its presence is used afterwards
+    for (unsigned int i=1; i<nTSamples_ && numGainWrong==0; i++ ) {
       if (xtalGains_[i-1]>xtalGains_[i]) {
         numGainWrong++;
         
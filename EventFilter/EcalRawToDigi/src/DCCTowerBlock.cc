@@ -223,7 +223,8 @@ int DCCTowerBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalI
   short numGain=1;
   bool gainSwitchError = false;
 
-  for (unsigned int i=1; i<nTSamples_; i++ ) {
+  // stop at the first wrong transition: only the flag is used afterwards
+  for (unsigned int i=1; i<nTSamples_ && !gainSwitchError; i++ ) {
     if (xtalGains_[i-1] >  xtalGains_[i] && numGain<5) gainSwitchError = true;
     if (xtalGains_[i-1] == xtalGains_[i]) numGain++;
     else numGain=1;
@@ -238,7 +238,7 @@ void SiPixelRawToDigi::produce( edm::Event& ev,
       for (IE is = errors.begin(); is != errors.end(); is++) {
 	uint32_t errordetid = is->first;
 	if (errordetid==dummydetid) {           // errors given dummy detId must be sorted by Fed
-	  nodeterrors.insert( nodeterrors.end(), errors[errordetid].begin(), errors[errordetid].end() );
+	  nodeterrors.insert( nodeterrors.end(), is->second.begin(), is->second.end() );
 	} else {
 	  edm::DetSet<SiPixelRawDataError>& errorDetSet = errorcollection->find_or_insert(errordetid);
 	  errorDetSet.data.insert(errorDetSet.data.end(), is->second.begin(), is->second.end());
@@ -300,7 +300,7 @@ void SiPixelRawToDigi::produce( edm::Event& ev,
 
   if(includeErrors) {
     edm::DetSet<SiPixelRawDataError>& errorDetSet = errorcollection->find_or_insert(dummydetid);
-    errorDetSet.data = nodeterrors;
+    errorDetSet.data = std::move(nodeterrors);
   }
   if (errorsInEvent) LogDebug("SiPixelRawToDigi") << "Error words were stored in this event";
 
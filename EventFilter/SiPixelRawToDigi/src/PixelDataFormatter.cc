@@ -216,7 +216,7 @@ void PixelDataFormatter::interpretRawData(bool& errorsInEvent, int fedId, const
     if UNLIKELY(skipROC || !rocp) continue;
     
     int adc  = (ww >> ADC_shift) & ADC_mask;
-    std::unique_ptr<LocalPixel> local;
+    GlobalPixel global;
 
     if(phase1 && layer==1) { // special case for layer 1ROC
       // for l1 roc use the roc column and row index instead of dcol and pixel index.
@@ -234,7 +234,7 @@ void PixelDataFormatter::interpretRawData(bool& errorsInEvent, int fedId, const
 	  errorcheck.conversionError(fedId, &converter, 3, ww, errors);
 	  continue;
 	}
-      local = std::make_unique<LocalPixel>(localCR); // local pixel coordinate 
+      global = rocp->toGlobal( LocalPixel(localCR) ); // global pixel coordinate (in module)
       //if(DANEK) cout<<local->dcol()<<" "<<local->pxid()<<" "<<local->rocCol()<<" "<<local->rocRow()<<endl;
 
     } else { // phase0 and phase1 except bpix layer 1
@@ -253,11 +253,10 @@ void PixelDataFormatter::interpretRawData(bool& errorsInEvent, int fedId, const
 	  errorcheck.conversionError(fedId, &converter, 3, ww, errors);
 	  continue;
 	}
-      local = std::make_unique<LocalPixel>(localDP); // local pixel coordinate 
+      global = rocp->toGlobal( LocalPixel(localDP) ); // global pixel coordinate (in module)
       //if(DANEK) cout<<local->dcol()<<" "<<local->pxid()<<" "<<local->rocCol()<<" "<<local->rocRow()<<endl;
     }    
 
-    GlobalPixel global = rocp->toGlobal( *local ); // global pixel coordinate (in module)
     (*detDigis).data.emplace_back(global.row, global.col, adc);
     //if(DANEK) cout<<global.row<<" "<<global.col<<" "<<adc<<endl;    
     LogTrace("") << (*detDigis).data.back();
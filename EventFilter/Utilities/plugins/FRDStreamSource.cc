@@ -150,8 +150,7 @@ bool FRDStreamSource::setRunAndEventInfo(edm::EventID& id, edm::TimeValue_t& the
       }
     }
     FEDRawData& fedData = rawData_->FEDData(fedId);
-    fedData.resize(fedSize);
-    memcpy(fedData.data(), event + eventSize, fedSize);
+    fedData.assign(event + eventSize, fedSize);
   }
   assert(eventSize == 0);
 
@@ -587,10 +587,8 @@ namespace evf{
     (*(fmt_.m_data.processed_[sc.streamID()]))++;
     eventCountForPathInit_[sc.streamID()].m_value++;
 
-    //fast path counter (events accumulated in a run)
-    unsigned long res = totalEventsProcessed_.fetch_add(1,std::memory_order_relaxed);
-    fmt_.m_data.fastPathProcessedJ_ = res+1; 
-    //fmt_.m_data.fastPathProcessedJ_ = totalEventsProcessed_.load(std::memory_order_relaxed);
+    //fast path counter (events accumulated in a run), published to the fast path at snapshot time
+    totalEventsProcessed_.fetch_add(1,std::memory_order_relaxed);
   }
 
   void FastMonitoringService::preSourceEvent(edm::StreamID sid)
@@ -719,6 +717,8 @@ namespace evf{
     // update macrostate
     fmt_.m_data.fastMacrostateJ_ = macrostate_;
 
+    fmt_.m_data.fastPathProcessedJ_ = totalEventsProcessed_.load(std::memory_order_relaxed);
+
     std::vector<const void*> microstateCopy(microstate_.begin(),microstate_.end());
 
     if (!isInitTransition_) {
@@ -765,8 +765,7 @@ edm::Timestamp FedRawDataInputSource::fillFEDRawDataCollection(FEDRawDataCollect
       }
     }
     FEDRawData& fedData = rawData.FEDData(fedId);
-    fedData.resize(fedSize);
-    memcpy(fedData.data(), event + eventSize, fedSize);
+    fedData.assign(event + eventSize, fedSize);
   }
   assert(eventSize == 0);
 
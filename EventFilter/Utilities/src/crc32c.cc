@@ -333,6 +333,14 @@ static uint32_t crc32c_hw(uint32_t crc, const unsigned char *buf, size_t len)
         (have) = (ecx >> 20) & 1; \
     } while (0)
 
+/* cpuid is a serializing instruction (and traps in virtual machines), so it
+   is queried only once instead of on every crc32c() call. */
+static int crc32c_sse42(void)
+{
+    static const int have = [] { int sse42; SSE42(sse42); return sse42; }();
+    return have;
+}
+
 #endif //defined(__x86_64__)
 
 /* Compute a CRC-32C.  If the crc32 instruction is available, use the hardware
@@ -340,10 +348,7 @@ static uint32_t crc32c_hw(uint32_t crc, const unsigned char *buf, size_t len)
 uint32_t crc32c(uint32_t crc, const unsigned char *buf, size_t len)
 {
 #if defined(__x86_64__)
-    int sse42;
-
-    SSE42(sse42);
-    return sse42 ? crc32c_hw(crc, buf, len) : crc32c_sw(crc, buf, len);
+    return crc32c_sse42() ? crc32c_hw(crc, buf, len) : crc32c_sw(crc, buf, len);
 #else
     return crc32c_sw(crc, buf, len);
 #endif
@@ -355,10 +360,7 @@ bool crc32c_hw_test()
 {
 
 #if defined(__x86_64__)
-  int sse42;
-
-  SSE42(sse42);
-  return sse42;
+  return crc32c_sse42();
 #else
   return 0;
 #endif
@@ -101,6 +101,7 @@ namespace edm {
   class ExceptionCollector;
   class MergeableRunProductMetadata;
   class OutputModuleCommunicator;
+  class PathsAndConsumesOfModules;
   class ProcessContext;
   class ProductRegistry;
   class PreallocationConfiguration;
@@ -164,6 +165,10 @@ namespace edm {
     void beginStream(unsigned int);
     void endStream(unsigned int);
 
+    /// Uses the module dependencies to decide which unscheduled modules
+    /// each stream starts at the beginning of an Event
+    void initializeEagerPrefetching(PathsAndConsumesOfModules const&);
+
     // Write the luminosity block
     void writeLumiAsync(WaitingTaskHolder iTask,
                         LuminosityBlockPrincipal const& lbp,
@@ -82,6 +82,7 @@ namespace edm {
     void endStream(StreamID iID, StreamContext& streamContext);
     
     AllWorkers const& allWorkers() const {return allWorkers_;}
+    UnscheduledCallProducer const& unscheduledWorkers() const {return unscheduled_;}
 
     void addToAllWorkers(Worker* w);
 
@@ -25,6 +25,7 @@
 #include <cassert>
 #include <limits>
 #include <memory>
+#include <utility>
 
 namespace edm {
   EventPrincipal::EventPrincipal(
@@ -66,13 +67,13 @@ namespace edm {
         ProductProvenanceRetriever const& provRetriever,
         DelayedReader* reader,
         bool deepCopyRetriever) {
-    eventSelectionIDs_ = eventSelectionIDs;
+    eventSelectionIDs_ = std::move(eventSelectionIDs);
     if (deepCopyRetriever) {
       provRetrieverPtr_->deepCopy(provRetriever);
     } else {
       provRetrieverPtr_->mergeParentProcessRetriever(provRetriever);
     }
-    branchListIndexes_ = branchListIndexes;
+    branchListIndexes_ = std::move(branchListIndexes);
     if(branchIDListHelper_->hasProducedProducts()) {
       // Add index into BranchIDListRegistry for products produced this process
       branchListIndexes_.push_back(branchIDListHelper_->producedBranchListIndex());
@@ -85,8 +86,8 @@ namespace edm {
                                      ProcessHistoryRegistry const& processHistoryRegistry,
                                      EventSelectionIDVector&& eventSelectionIDs,
                                      BranchListIndexes&& branchListIndexes) {
-    eventSelectionIDs_ = eventSelectionIDs;
-    branchListIndexes_ = branchListIndexes;
+    eventSelectionIDs_ = std::move(eventSelectionIDs);
+    branchListIndexes_ = std::move(branchListIndexes);
     if(branchIDListHelper_->hasProducedProducts()) {
       // Add index into BranchIDListRegistry for products produced this process
       branchListIndexes_.push_back(branchIDListHelper_->producedBranchListIndex());
@@ -350,6 +351,11 @@ namespace edm {
 
     BranchID parent = pidToBid(pid);
 
+    unsigned nKeys = keys.size();
+    unsigned int doNotLookForThisIndex = std::numeric_limits<unsigned int>::max();
+    // reused for every thinned container of this parent
+    std::vector<unsigned int> thinnedIndexes;
+
     // Loop over thinned containers which were made by selecting elements from the parent container
     for(auto associatedBranches = thinnedAssociationsHelper_->parentBegin(parent),
                            iEnd = thinnedAssociationsHelper_->parentEnd(parent);
@@ -363,9 +369,7 @@ namespace edm {
         continue;
       }
 
-      unsigned nKeys = keys.size();
-      unsigned int doNotLookForThisIndex = std::numeric_limits<unsigned int>::max();
-      std::vector<unsigned int> thinnedIndexes(nKeys, doNotLookForThisIndex);
+      thinnedIndexes.assign(nKeys, doNotLookForThisIndex);
       bool hasAny = false;
       for(unsigned k = 0; k < nKeys; ++k) {
         // Already found this one
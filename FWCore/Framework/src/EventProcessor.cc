@@ -539,6 +539,7 @@ namespace edm {
 
     //NOTE: this may throw
     checkForModuleDependencyCorrectness(pathsAndConsumesOfModules_, printDependencies_);
+    schedule_->initializeEagerPrefetching(pathsAndConsumesOfModules_);
     actReg_->preBeginJobSignal_(pathsAndConsumesOfModules_, processContext_);
 
     if(preallocations_.numberOfLuminosityBlocks() > 1) {
@@ -23,13 +23,13 @@ namespace edm {
                             std::string const& moduleLabel,
                             signalslot::Signal<void(ModuleDescription const&)>& iPre,
                             signalslot::Signal<void(ModuleDescription const&)>& iPost) {
-    auto modItr = labelToModule_.find(moduleLabel);
-    if(modItr == labelToModule_.end()) {
+    auto modItr = labelToModule_.lower_bound(moduleLabel);
+    if(modItr == labelToModule_.end() || modItr->first != moduleLabel) {
       auto modPtr=
       Factory::get()->makeModule(p,iPre,iPost);
       
       // Transfer ownership of worker to the registry
-      labelToModule_[moduleLabel] = modPtr;
+      labelToModule_.emplace_hint(modItr, moduleLabel, modPtr);
       return modPtr;
     }
     return get_underlying_safe(modItr->second);
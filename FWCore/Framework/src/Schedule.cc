@@ -1168,6 +1168,12 @@ namespace edm {
     streamSchedules_[iStreamID]->endStream();
   }
   
+  void Schedule::initializeEagerPrefetching(PathsAndConsumesOfModules const& iPnC) {
+    for(auto& s : streamSchedules_) {
+      s->initializeEagerPrefetching(iPnC);
+    }
+  }
+
   void Schedule::processOneEventAsync(WaitingTaskHolder iTask,
                                       unsigned int iStreamID,
                                       EventPrincipal& ep,
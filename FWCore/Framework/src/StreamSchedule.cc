@@ -4,6 +4,7 @@
 #include "DataFormats/Provenance/interface/ProcessConfiguration.h"
 #include "DataFormats/Provenance/interface/ProductRegistry.h"
 #include "FWCore/Framework/interface/OutputModuleDescription.h"
+#include "FWCore/Framework/interface/PathsAndConsumesOfModules.h"
 #include "FWCore/Framework/interface/TriggerNamesService.h"
 #include "FWCore/Framework/interface/TriggerReport.h"
 #include "FWCore/Framework/interface/TriggerTimingReport.h"
@@ -158,12 +159,15 @@ namespace edm {
     total_events_(),
     total_passed_(),
     number_of_unscheduled_modules_(0),
+    eagerUnscheduledWorkers_(),
+    eagerUnscheduledPrefetch_(false),
     streamID_(streamID),
     streamContext_(streamID_, processContext),
     endpathsAreActive_(true),
     skippingEvent_(false){
 
     ParameterSet const& opts = proc_pset.getUntrackedParameterSet("options", ParameterSet());
+    eagerUnscheduledPrefetch_ = opts.getUntrackedParameter<bool>("eagerUnscheduledPrefetch", false);
     bool hasPath = false;
     std::vector<std::string> const& pathNames = tns.getTrigPaths();
     std::vector<std::string> const& endPathNames = tns.getEndPaths();
@@ -393,6 +397,11 @@ namespace edm {
       for(auto& p : end_paths_) {
         p.setEarlyDeleteHelpers(alreadySeenWorkers);
       }
+      //the number of helpers using each branch is the same for every event
+      earlyDeleteBranchInitialCounts_.assign(earlyDeleteBranchToCount_.size(), 0U);
+      for(auto index: earlyDeleteHelperToBranchIndicies_) {
+        ++earlyDeleteBranchInitialCounts_[index];
+      }
       resetEarlyDelete();
     }
   }
@@ -519,6 +528,46 @@ namespace edm {
     found->beginStream(streamID_,streamContext_);
   }
 
+  void StreamSchedule::initializeEagerPrefetching(PathsAndConsumesOfModules const& iPnC) {
+    eagerUnscheduledWorkers_.clear();
+    if(not eagerUnscheduledPrefetch_) {
+      return;
+    }
+
+    auto const& unscheduled = workerManager_.unscheduledWorkers();
+    std::map<unsigned int, Worker*> unscheduledIDToWorker;
+    for(auto worker: unscheduled) {
+      unscheduledIDToWorker.emplace(worker->description().id(), worker);
+    }
+    if(unscheduledIDToWorker.empty()) {
+      return;
+    }
+
+    //walk the consumes graph starting from all the scheduled modules
+    std::vector<unsigned int> toVisit;
+    std::set<unsigned int> visited;
+    for(auto const& worker: allWorkers()) {
+      auto id = worker->description().id();
+      if(unscheduledIDToWorker.find(id) == unscheduledIDToWorker.end()) {
+        toVisit.push_back(id);
+        visited.insert(id);
+      }
+    }
+    while(not toVisit.empty()) {
+      auto id = toVisit.back();
+      toVisit.pop_back();
+      for(auto const* desc: iPnC.modulesWhoseProductsAreConsumedBy(id)) {
+        if(visited.insert(desc->id()).second) {
+          toVisit.push_back(desc->id());
+          auto itFound = unscheduledIDToWorker.find(desc->id());
+          if(itFound != unscheduledIDToWorker.end()) {
+            eagerUnscheduledWorkers_.push_back(itFound->second);
+          }
+        }
+      }
+    }
+  }
+
   std::vector<ModuleDescription const*>
   StreamSchedule::getAllModuleDescriptions() const {
     std::vector<ModuleDescription const*> result;
@@ -614,6 +663,23 @@ namespace edm {
       // run under that condition.
       WaitingTaskHolder taskHolder(pathsDone);
 
+      if(not eagerUnscheduledWorkers_.empty()) {
+        //Any exception is cached by the Worker and will be reported to
+        // the module which asks for the data. If no module asks, the
+        // exception must not affect the Event.
+        auto eagerDone = make_waiting_task(tbb::task::allocate_root(),
+                                           [allPathsHolder](std::exception_ptr const*) mutable
+                                           {
+                                             allPathsHolder.doneWaiting(std::exception_ptr{});
+                                           });
+        WaitingTaskHolder eagerHolder(eagerDone);
+        ParentContext parentContext(&streamContext_);
+        for(auto worker: eagerUnscheduledWorkers_) {
+          worker->doWorkAsync<OccurrenceTraits<EventPrincipal, BranchActionStreamBegin>>(
+            eagerDone, ep, es, serviceToken, streamID_, parentContext, &streamContext_);
+        }
+      }
+
       //start end paths first so on single threaded the paths will run first
       for(auto it = end_paths_.rbegin(), itEnd = end_paths_.rend();
           it != itEnd; ++it) {
@@ -909,13 +975,9 @@ namespace edm {
 
   void 
   StreamSchedule::resetEarlyDelete() {
-    //must be sure we have cleared the count first
-    for(auto& count:earlyDeleteBranchToCount_) {
-      count.count = 0;
-    }
-    //now reset based on how many helpers use that branch
-    for(auto& index: earlyDeleteHelperToBranchIndicies_) {
-      ++(earlyDeleteBranchToCount_[index].count);
+    //reset based on how many helpers use that branch
+    for(size_t i = 0, n = earlyDeleteBranchToCount_.size(); i < n; ++i) {
+      earlyDeleteBranchToCount_[i].count = earlyDeleteBranchInitialCounts_[i];
     }
     for(auto& helper: earlyDeleteHelpers_) {
       helper.reset();
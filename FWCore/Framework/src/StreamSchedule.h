@@ -102,6 +102,7 @@ namespace edm {
   class ExceptionCollector;
   class ExceptionToActionTable;
   class OutputModuleCommunicator;
+  class PathsAndConsumesOfModules;
   class ProcessContext;
   class UnscheduledCallProducer;
   class WorkerInPath;
@@ -192,6 +193,12 @@ namespace edm {
     void beginStream();
     void endStream();
 
+    /// If the 'eagerUnscheduledPrefetch' option was set, find all unscheduled
+    /// modules whose products are (directly or indirectly) consumed by a module
+    /// on a Path or EndPath. Those are started at the beginning of each Event
+    /// instead of when a Path first reaches a module consuming their products.
+    void initializeEagerPrefetching(PathsAndConsumesOfModules const& iPnC);
+
     StreamID streamID() const { return streamID_; }
     
     /// Return a vector allowing const access to all the
@@ -354,6 +361,9 @@ namespace edm {
     // keep track of how many modules are left that read this data but have
     // not yet been run in this event
     std::vector<BranchToCount> earlyDeleteBranchToCount_;
+    //The value each entry of earlyDeleteBranchToCount_ starts every event with,
+    // i.e. how many EarlyDeleteHelpers use that branch
+    std::vector<unsigned int> earlyDeleteBranchInitialCounts_;
     //NOTE the following is effectively internal data for each EarlyDeleteHelper
     // but putting it into one vector makes for better allocation as well as
     // faster iteration when used to reset the earlyDeleteBranchToCount_
@@ -368,6 +378,10 @@ namespace edm {
     int                            total_events_;
     int                            total_passed_;
     unsigned int                   number_of_unscheduled_modules_;
+
+    //unscheduled workers started as soon as the Event begins
+    std::vector<Worker*>           eagerUnscheduledWorkers_;
+    bool                           eagerUnscheduledPrefetch_;
     
     StreamID                streamID_;
     StreamContext           streamContext_;
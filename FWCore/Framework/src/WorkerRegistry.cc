@@ -39,10 +39,10 @@ namespace edm {
 
   Worker* WorkerRegistry::getWorker(WorkerParams const& p, std::string const& moduleLabel) {
 
-    WorkerMap::iterator workerIt = m_workerMap.find(moduleLabel);
+    WorkerMap::iterator workerIt = m_workerMap.lower_bound(moduleLabel);
   
     // if the worker is not there, make it
-    if (workerIt == m_workerMap.end()){
+    if (workerIt == m_workerMap.end() || workerIt->first != moduleLabel){
       MakeModuleParams mmp(p.pset_,*p.reg_,p.preallocate_,p.processConfiguration_);
       auto modulePtr = modRegistry_->getModule(mmp,moduleLabel,
                                                actReg_->preModuleConstructionSignal_,
@@ -52,8 +52,8 @@ namespace edm {
       workerPtr->setActivityRegistry(actReg_);
 
       // Transfer ownership of worker to the registry
-      m_workerMap[moduleLabel] = std::shared_ptr<Worker>(workerPtr.release()); // propagate_const<T> has no reset() function
-      return m_workerMap[moduleLabel].get(); 
+      workerIt = m_workerMap.emplace_hint(workerIt, moduleLabel, std::shared_ptr<Worker>(workerPtr.release())); // propagate_const<T> has no reset() function
+      return workerIt->second.get(); 
     } 
     return (workerIt->second.get());
   }
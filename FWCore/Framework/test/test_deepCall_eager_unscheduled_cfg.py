@@ -0,0 +1,46 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("TEST")
+
+import FWCore.Framework.test.cmsExceptionsFatalOption_cff
+process.options = cms.untracked.PSet(
+    Rethrow = FWCore.Framework.test.cmsExceptionsFatalOption_cff.Rethrow,
+    numberOfThreads = cms.untracked.uint32(4),
+    numberOfStreams = cms.untracked.uint32(4),
+    eagerUnscheduledPrefetch = cms.untracked.bool(True)
+)
+
+process.maxEvents = cms.untracked.PSet(
+    input = cms.untracked.int32(20)
+)
+process.source = cms.Source("EmptySource")
+
+process.one = cms.EDProducer("IntProducer",
+    ivalue = cms.int32(1)
+)
+
+process.result1 = cms.EDProducer("AddIntsProducer",
+    labels = cms.vstring('one')
+)
+
+process.result2 = cms.EDProducer("AddIntsProducer",
+    labels = cms.vstring('result1', 
+        'one')
+)
+
+process.result4 = cms.EDProducer("AddIntsProducer",
+    labels = cms.vstring('result2', 
+        'result2')
+)
+
+#not consumed by anything so must not be run
+process.notUsed = cms.EDProducer("FailingProducer")
+
+process.get = cms.EDAnalyzer("IntTestAnalyzer",
+    valueMustMatch = cms.untracked.int32(4),
+    moduleLabel = cms.untracked.string('result4')
+)
+
+process.t = cms.Task(process.one, process.result1, process.result2, process.result4, process.notUsed)
+
+process.p = cms.Path(process.get, process.t)
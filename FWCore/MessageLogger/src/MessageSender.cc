@@ -56,9 +56,13 @@ namespace  {
               (severity.getLevel() ==iOther.severity.getLevel()));
     }
     size_t smallHash() const {
+      //combine the member hashes rather than hashing a concatenated
+      // temporary string, which needs an allocation for every message
       std::hash<std::string> h;
-
-      return h( category+module+severity.getSymbol());
+      std::size_t seed = h(category);
+      seed ^= h(module) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+      seed ^= std::hash<int>()(severity.getLevel()) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+      return seed;
     }
 
     struct key_hash {
@@ -34,7 +34,17 @@ namespace edm {
   
     bool
     Registry::insertMapped(value_type const& v, bool forceUpdate) {
-      auto wasAdded = m_map.insert(std::make_pair(v.id(),v));
+      //identical PSets are registered many times, so avoid copying one
+      // into a temporary pair when it is already present
+      auto const& id = v.id();
+      auto found = m_map.find(id);
+      if(found != m_map.end()) {
+        if(forceUpdate) {
+          found->second = v;
+        }
+        return false;
+      }
+      auto wasAdded = m_map.insert(std::make_pair(id,v));
       if(forceUpdate and not wasAdded.second) {
         wasAdded.first->second = v;
       }
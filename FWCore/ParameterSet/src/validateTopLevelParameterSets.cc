@@ -29,6 +29,8 @@ void fillOptionsDescription(ParameterSetDescription& description) {
     setComment("Set false to disable exception throws when configuration validation detects illegal parameters");
   description.addUntracked<bool>("printDependencies", false)->
     setComment("Print data dependencies between modules");
+  description.addUntracked<bool>("eagerUnscheduledPrefetch", false)->
+    setComment("Set true to start, at the beginning of each Event, all unscheduled modules whose data is needed by modules on Paths or EndPaths, rather than waiting until a Path reaches the module consuming the data");
 
 
   // No default for this one because the parameter value is
@@ -129,6 +129,9 @@ CacheParser::read(std::istream& iIn,
   unsigned long recordNumber=0;
   
   std::string pluginType;
+  //consecutive lines usually share a plugin type so avoid a map lookup for each
+  std::string lastPluginType;
+  std::vector<PluginInfo>* infos = nullptr;
   
   PluginInfo info;
 
@@ -137,13 +140,20 @@ CacheParser::read(std::istream& iIn,
     if( not readline(iIn,iDirectory,recordNumber,info,pluginType) ) {
       break;
     }
-    iOut[pluginType].push_back(info);
+    if(infos == nullptr or pluginType != lastPluginType) {
+      infos = &iOut[pluginType];
+      lastPluginType = pluginType;
+    }
+    infos->push_back(info);
   }
   //now do a sort which preserves any previous order for files
+  // (categories filled by earlier files are usually already in order)
   for(CacheParser::CategoryToInfos::iterator it = iOut.begin(), itEnd=iOut.end();
       it != itEnd;
       ++it) {
-    std::stable_sort(it->second.begin(),it->second.end(), CompPluginInfos());
+    if(not std::is_sorted(it->second.begin(),it->second.end(), CompPluginInfos())) {
+      std::stable_sort(it->second.begin(),it->second.end(), CompPluginInfos());
+    }
   }
 }
 
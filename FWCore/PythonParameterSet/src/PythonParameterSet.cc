@@ -1,6 +1,8 @@
 #include "FWCore/PythonParameterSet/interface/PythonParameterSet.h"
 #include "FWCore/ParameterSet/interface/FileInPath.h"
 
+#include <utility>
+
 PythonParameterSet::PythonParameterSet()
 :  theParameterSet()
 {
@@ -17,7 +19,7 @@ void PythonParameterSet::addVPSet(bool tracked, std::string const& name,
   for(std::vector<PythonParameterSet>::iterator ppsetItr = v.begin(), ppsetItrEnd = v.end();
       ppsetItr != ppsetItrEnd; ++ppsetItr)
   {
-    v2.push_back(ppsetItr->theParameterSet);
+    v2.push_back(std::move(ppsetItr->theParameterSet));
   }
   addParameter(tracked, name, v2);
 }
@@ -10,6 +10,9 @@
  Description: Provides container like access to a column of a Table
 
  Usage:
+    The values of a column are contiguous in memory. For a column obtained
+ from a Table the storage starts on an impl::kColumnAlignment boundary so
+ data() and size() can be passed directly to vectorized code.
 
 */
 //
@@ -35,6 +38,9 @@ public:
   
   T const* begin() const { return m_begin; }
   T const* end() const { return m_end; }
+
+  T const* data() const { return m_begin; }
+  size_t size() const { return m_end-m_begin; }
   
 private:
   T const* m_begin = nullptr;
@@ -50,6 +56,9 @@ public:
   T* begin() const { return m_begin; }
   T* end() const { return m_end; }
 
+  T* data() const { return m_begin; }
+  size_t size() const { return m_end-m_begin; }
+
 private:
   T* m_begin = nullptr;
   T* m_end = nullptr;
@@ -60,6 +60,19 @@
  row and iterating over just one column compile down to exactly the same machine
  instructions.
  
+ The storage of each column starts on a 64 byte boundary (impl::kColumnAlignment)
+ so a column can be handed to a vectorized kernel as a pointer and a length
+ \code
+ auto etas = sphereTable.column<Eta>();
+ kernel(etas.data(), etas.size());
+ \endcode
+ 
+ Rows can be removed in place by giving a predicate which is passed a RowView
+ of each row; the order of the remaining rows is preserved.
+ \code
+ sphereTable.filter([](auto const& iRow) { return std::abs(iRow.template get<Eta>()) < 2.5; });
+ \endcode
+ 
  A Table can be constructed either by
  1) passing as many containers as their are columns
  \code
@@ -114,9 +127,11 @@
 //
 
 // system include files
+#include <cassert>
 #include <memory>
 #include <tuple>
 #include <array>
+#include <vector>
 
 // user include files
 #include "FWCore/SOA/interface/TableItr.h"
@@ -169,7 +184,7 @@ namespace soa {
     }
     
     ~Table() {
-      dtr<0>(m_values);
+      dtr<0>(m_size, m_values);
     }
     
     Table<Args...>& operator=(Table<Args...>&& iOther) {
@@ -196,6 +211,17 @@ namespace soa {
       m_size = iNewSize;
     }
     
+    template<typename F>
+    void filter(F&& iPredicate) {
+      std::vector<bool> keep;
+      keep.reserve(m_size);
+      Table<Args...> const& cThis = *this;
+      for(auto const& row: cThis) {
+        keep.push_back(iPredicate(row));
+      }
+      m_size = compactAll(m_size, keep, m_values, std::make_index_sequence<sizeof...(Args)>{});
+    }
+    
     template<typename U>
     typename U::type const& get(size_t iRow) const {
       return *(static_cast<typename U::type const*>(columnAddress<U>())+iRow);
@@ -261,11 +287,11 @@ namespace soa {
 
     //Recursive destructor handling
     template <int I>
-    static void dtr(std::array<void*, sizeof...(Args)>& iArray) {
+    static void dtr(size_t iSize, std::array<void*, sizeof...(Args)>& iArray) {
       if constexpr(I<sizeof...(Args)) {
         using Type = typename std::tuple_element<I,Layout>::type::type;
-        delete [] static_cast<Type*>(iArray[I]);
-        dtr<I+1>(iArray);
+        impl::deallocateColumn(static_cast<Type*>(iArray[I]), iSize);
+        dtr<I+1>(iSize, iArray);
       }
     }
 
@@ -282,7 +308,7 @@ namespace soa {
       static void ctrFiller(std::array<void *, sizeof...(Args)>& oValues, size_t iSize, T const& iContainer, U... iU) {
         assert(iContainer.size() == iSize);
         using Type = typename std::tuple_element<I,Layout>::type::type;
-        Type  * temp = new Type [iSize];
+        Type  * temp = impl::allocateColumn<Type>(iSize);
         unsigned int index = 0;
         for( auto const& v: iContainer) {
           temp[index] = v;
@@ -329,7 +355,7 @@ namespace soa {
         if constexpr(I<sizeof...(Args)) {
           using Layout = std::tuple<Args...>;
           using Type = typename std::tuple_element<I,Layout>::type::type;
-          oValues[I] = new Type[iSize];
+          oValues[I] = impl::allocateColumn<Type>(iSize);
           presize<I+1>(oValues,iSize);
         }
       }
@@ -369,11 +395,10 @@ namespace soa {
     static void copyFromToWithResize(size_t iNElements, std::array<void *, sizeof...(Args)> const& iFrom, std::array<void*, sizeof...(Args)>& oTo) {
       using Layout = std::tuple<Args...>;
       using Type = typename std::tuple_element<I,Layout>::type::type;
-      Type* oldPtr = static_cast<Type*>(oTo[I]);
-      Type* ptr = new Type[iNElements];
+      assert(oTo[I] == nullptr);
+      Type* ptr = impl::allocateColumn<Type>(iNElements);
       oTo[I]=ptr;
       std::copy(static_cast<Type const*>(iFrom[I]), static_cast<Type const*>(iFrom[I])+iNElements, ptr);
-      delete [] oldPtr;
     }
     
     template<int I>
@@ -382,16 +407,43 @@ namespace soa {
         using Layout = std::tuple<Args...>;
         using Type = typename std::tuple_element<I,Layout>::type::type;
         Type* oldPtr = static_cast<Type*>(ioArray[I]);
-        auto ptr = new Type[iNewSize];
+        auto ptr = impl::allocateColumn<Type>(iNewSize);
         auto nToCopy = std::min(iOldSize,iNewSize);
         std::copy(static_cast<Type const*>(ioArray[I]), static_cast<Type const*>(ioArray[I])+nToCopy, ptr);
         resizeFromTo<I+1>(iOldSize, iNewSize, ioArray );
         
-        delete [] oldPtr;
+        impl::deallocateColumn(oldPtr, iOldSize);
         ioArray[I]=ptr;
       }
     }
     
+    template<size_t... I>
+    static size_t compactAll(size_t iSize, std::vector<bool> const& iKeep, std::array<void *, sizeof...(Args)>& ioArray,
+                             std::index_sequence<I...>) {
+      size_t nKept = 0;
+      ((nKept = compact<I>(iSize, iKeep, ioArray)), ...);
+      return nKept;
+    }
+    
+    template<int I>
+    static size_t compact(size_t iSize, std::vector<bool> const& iKeep, std::array<void *, sizeof...(Args)>& ioArray) {
+      using Layout = std::tuple<Args...>;
+      using Type = typename std::tuple_element<I,Layout>::type::type;
+      auto ptr = static_cast<Type*>(ioArray[I]);
+      size_t nKept = 0;
+      for(size_t i = 0; i < iSize; ++i) {
+        if(iKeep[i]) {
+          if(nKept != i) {
+            ptr[nKept] = std::move(ptr[i]);
+          }
+          ++nKept;
+        }
+      }
+      //the storage keeps its original length, but only the kept values stay constructed
+      std::destroy(ptr+nKept, ptr+iSize);
+      return nKept;
+    }
+    
     template<int I>
     static void resetStartingAt(size_t iStartIndex, size_t iEndIndex,std::array<void *, sizeof...(Args)>& ioArray) {
       if constexpr(I < sizeof...(Args)) {
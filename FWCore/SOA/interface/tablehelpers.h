@@ -18,6 +18,9 @@
 //
 
 // system include files
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <type_traits>
 #include <tuple>
 
@@ -41,6 +44,33 @@ struct GetIndex {
   GetIndex<I+1, T,TPL>>::type::index;
 };
 
+//Alignment of the storage of each column of a Table. This is the size of a
+// cache line and of the widest vector register (AVX-512), so a column can be
+// handed directly to code using aligned vector loads.
+constexpr std::size_t kColumnAlignment = 64;
+
+template<typename T>
+T* allocateColumn(std::size_t iSize) {
+  constexpr std::size_t alignment = alignof(T) > kColumnAlignment ? alignof(T) : kColumnAlignment;
+  void* memory = ::operator new[](iSize*sizeof(T), std::align_val_t{alignment});
+  T* values = static_cast<T*>(memory);
+  try {
+    std::uninitialized_default_construct_n(values, iSize);
+  } catch(...) {
+    ::operator delete[](memory, std::align_val_t{alignment});
+    throw;
+  }
+  return values;
+}
+
+template<typename T>
+void deallocateColumn(T* iValues, std::size_t iSize) {
+  if(iValues == nullptr) { return; }
+  constexpr std::size_t alignment = alignof(T) > kColumnAlignment ? alignof(T) : kColumnAlignment;
+  std::destroy_n(iValues, iSize);
+  ::operator delete[](static_cast<void*>(iValues), std::align_val_t{alignment});
+}
+
 }
 }
 }
@@ -31,6 +31,8 @@ class testTable: public CppUnit::TestFixture
   CPPUNIT_TEST(tableExaminerTest);
   CPPUNIT_TEST(tableResizeTest);
   CPPUNIT_TEST(mutabilityTest);
+  CPPUNIT_TEST(alignmentTest);
+  CPPUNIT_TEST(filterTest);
   CPPUNIT_TEST_SUITE_END();
 public:
   void setUp(){}
@@ -45,6 +47,8 @@ public:
   void tableExaminerTest();
   void tableResizeTest();
   void mutabilityTest();
+  void alignmentTest();
+  void filterTest();
 };
 
 namespace ts {
@@ -440,5 +444,56 @@ void testTable::mutabilityTest() {
   CPPUNIT_ASSERT(row.get<Phi>() == 10.);
 }
 
+void testTable::alignmentTest() {
+  using namespace edm::soa;
+  using namespace ts;
+
+  std::vector<float> eta = {1., -2., 3.};
+  std::vector<std::string> label = {"a", "b", "c"};
+  
+  auto isAligned = [](void const* iPtr) {
+    return reinterpret_cast<std::uintptr_t>(iPtr) % edm::soa::impl::kColumnAlignment == 0;
+  };
+  
+  MyOtherJetTable jets{eta, label};
+  CPPUNIT_ASSERT(isAligned(jets.column<Eta>().data()));
+  CPPUNIT_ASSERT(isAligned(jets.column<Label>().data()));
+  CPPUNIT_ASSERT(jets.column<Eta>().size() == 3);
+  
+  jets.resize(17);
+  CPPUNIT_ASSERT(isAligned(jets.column<Eta>().data()));
+  CPPUNIT_ASSERT(isAligned(jets.column<Label>().data()));
+  CPPUNIT_ASSERT(jets.column<Eta>().size() == 17);
+  
+  MyOtherJetTable copy{jets};
+  CPPUNIT_ASSERT(isAligned(copy.column<Eta>().data()));
+  CPPUNIT_ASSERT(copy.column<Label>().data()[2] == "c");
+}
+
+void testTable::filterTest() {
+  using namespace edm::soa;
+  using namespace ts;
+
+  std::vector<float> eta = {1., -2.7, 0.3, 3.1, -0.5};
+  std::vector<std::string> label = {"a", "b", "c", "d", "e"};
+  
+  MyOtherJetTable jets{eta, label};
+  jets.filter([](auto const& iRow) { return std::abs(iRow.template get<Eta>()) < 2.5; });
+  
+  CPPUNIT_ASSERT(jets.size() == 3);
+  CPPUNIT_ASSERT(jets.get<Eta>(0) == eta[0]);
+  CPPUNIT_ASSERT(jets.get<Eta>(1) == eta[2]);
+  CPPUNIT_ASSERT(jets.get<Eta>(2) == eta[4]);
+  CPPUNIT_ASSERT(jets.get<Label>(0) == "a");
+  CPPUNIT_ASSERT(jets.get<Label>(1) == "c");
+  CPPUNIT_ASSERT(jets.get<Label>(2) == "e");
+
+  jets.resize(4);
+  CPPUNIT_ASSERT(jets.get<Label>(2) == "e");
+  CPPUNIT_ASSERT(jets.get<Label>(3).empty());
+
+  jets.filter([](auto const&) { return false; });
+  CPPUNIT_ASSERT(jets.size() == 0);
+}
 
 #include <Utilities/Testing/interface/CppUnit_testdriver.icpp>
@@ -27,6 +27,7 @@
 #include <fstream>
 #include <sstream>
 #include <set>
+#include <algorithm>
 
 #ifdef __linux__
 #include <sched.h>
@@ -220,30 +221,18 @@ namespace edm {
         if (!fcpuinfo.is_open()) {
             return false;
         }
+        std::string buf;
         while (!fcpuinfo.eof()) {
-            std::string buf;
             std::getline(fcpuinfo, buf);
 
-            std::istringstream iss(buf);
-            std::string token;
-            std::string property;
+            // the property is the text before the first ':', the value is
+            // the rest of the line with any further ':' removed
+            std::string::size_type colon = buf.find(':');
+            std::string property = buf.substr(0, colon);
             std::string value;
-
-            int time = 1;
-
-            while(std::getline(iss, token, ':')) {
-                switch(time){
-                case 1:
-                    property = token;
-                    break;
-                case 2:
-                    value = token;
-                    break;
-                default:
-                    value += token;
-                    break;
-                }
-                time++;
+            if (colon != std::string::npos) {
+                value = buf.substr(colon+1);
+                value.erase(std::remove(value.begin(), value.end(), ':'), value.end());
             }
             trim(property);
             trim(value);
@@ -32,6 +32,7 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <string>
 
 namespace {
 
@@ -89,17 +90,19 @@ namespace {
   // Message-assembly utilities
   template <typename T>
   std::enable_if_t<std::is_integral<T>::value>
-  concatenate(std::ostream& os, T const t)
+  concatenate(std::string& s, T const t)
   {
-    os << ' ' << t;
+    s += ' ';
+    s += std::to_string(t);
   }
 
   template <typename H, typename... T>
   std::enable_if_t<std::is_integral<H>::value>
-  concatenate(std::ostream& os, H const h, T const... t)
+  concatenate(std::string& s, H const h, T const... t)
   {
-    os << ' ' << h;
-    concatenate(os, t...);
+    s += ' ';
+    s += std::to_string(h);
+    concatenate(s, t...);
   }
 
   enum class step : char { preSourceEvent = 'S',
@@ -139,11 +142,11 @@ namespace {
   template <step S, typename... ARGS>
   std::string assembleMessage(ARGS const... args)
   {
-    std::ostringstream oss;
-    oss << S;
-    concatenate(oss, args...);
-    oss << '\n';
-    return oss.str();
+    // integral fields only, so std::to_string gives the same text as an ostream
+    std::string msg(1, static_cast<std::underlying_type_t<step>>(S));
+    concatenate(msg, args...);
+    msg += '\n';
+    return msg;
   }
 
   Phase toTransitionImpl(edm::StreamContext const& iContext) {
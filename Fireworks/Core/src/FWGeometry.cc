@@ -19,6 +19,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
+#include <unordered_set>
 
 FWGeometry::FWGeometry( void ):m_producerVersion(0)
 {}
@@ -229,6 +230,7 @@ std::vector<unsigned int>
 FWGeometry::getMatchedIds( Detector det ) const
 {
    std::vector<unsigned int> ids;
+   std::unordered_set<unsigned int> wafers;
    
    for(const auto& it : m_idToInfo)
    {
@@ -238,14 +240,7 @@ FWGeometry::getMatchedIds( Detector det ) const
 
       // select only the first cell of each wafer
       if(det != HGCalHSc){
-        bool flag(false);
-
-        for(const auto& id_it : ids) {
-           flag = (~0x3FF & it.id) == (~0x3FF & id_it);
-           if(flag) break;
-        }
-
-        if(flag) continue;
+        if(!wafers.insert(~0x3FF & it.id).second) continue;
       }
       
       ids.push_back( it.id );
@@ -302,7 +302,9 @@ unsigned int CaloSubdetectorGeometry::sizeForDenseIndex(const DetId& id) const {
 std::shared_ptr<const CaloCellGeometry> 
 CaloSubdetectorGeometry::cellGeomPtr(uint32_t index) const {
   // Default version
+  // The cell is owned by the geometry, so hand out a non-owning pointer.
+  // The aliasing constructor with an empty owner avoids allocating a
+  // control block on every lookup.
   auto ptr = getGeometryRawPtr(index);
-  static const auto do_not_delete = [](const void*){};
-  return ptr == nullptr ? nullptr : std::shared_ptr<const CaloCellGeometry>(ptr, do_not_delete);
+  return ptr == nullptr ? nullptr : std::shared_ptr<const CaloCellGeometry>(std::shared_ptr<const CaloCellGeometry>(), ptr);
 }
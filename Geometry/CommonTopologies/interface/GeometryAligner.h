@@ -79,9 +79,10 @@ void GeometryAligner::applyAlignments( C* geometry,
   std::vector<AlignTransform>::const_iterator iAlign = alignments->m_align.begin();
   std::vector<AlignTransformErrorExtended>::const_iterator 
 	iAlignError = alignmentErrors->m_alignError.begin();
-  //copy  geometry->theMap to a real map to order it....
-  std::map<unsigned int, GeomDet const *> theMap;
-  std::copy(geometry->theMap.begin(), geometry->theMap.end(), std::inserter(theMap,theMap.begin()));
+  //copy  geometry->theMap to a vector sorted by DetId to order it....
+  std::vector<std::pair<unsigned int, GeomDet const *> > theMap(geometry->theMap.begin(), geometry->theMap.end());
+  std::sort(theMap.begin(), theMap.end(),
+	    [](auto const& a, auto const& b) { return a.first < b.first; });
   unsigned int nAPE = 0;
   for ( auto iPair = theMap.begin(); 
 	iPair != theMap.end(); ++iPair, ++iAlign, ++iAlignError )
@@ -131,9 +132,10 @@ void GeometryAligner::attachSurfaceDeformations( C* geometry,
   edm::LogInfo("Alignment") << "@SUB=GeometryAligner::attachSurfaceDeformations" 
 			    << "Starting to attach surface deformations.";
 
-  //copy geometry->theMapUnit to a real map to order it....
-  std::map<unsigned int, GeomDetUnit const*> theMap;
-  std::copy(geometry->theMapUnit.begin(), geometry->theMapUnit.end(), std::inserter(theMap, theMap.begin()));
+  //copy geometry->theMapUnit to a vector sorted by DetId to order it....
+  std::vector<std::pair<unsigned int, GeomDetUnit const*> > theMap(geometry->theMapUnit.begin(), geometry->theMapUnit.end());
+  std::sort(theMap.begin(), theMap.end(),
+	    [](auto const& a, auto const& b) { return a.first < b.first; });
   
   unsigned int nSurfDef = 0;
   unsigned int itemIndex = 0;
@@ -159,8 +161,7 @@ void GeometryAligner::attachSurfaceDeformations( C* geometry,
     
     // get the parameters and put them into a vector
     AlignmentSurfaceDeformations::ParametersConstIteratorPair iteratorPair = surfaceDeformations->parameters(itemIndex);
-    std::vector<double> parameters;
-    std::copy(iteratorPair.first, iteratorPair.second, std::back_inserter(parameters));
+    std::vector<double> parameters(iteratorPair.first, iteratorPair.second);
     
     // create SurfaceDeformation via factory
     SurfaceDeformation * surfDef = SurfaceDeformationFactory::create( (*iItem).m_parametrizationType, parameters);
@@ -415,10 +415,9 @@ void TriggerSummaryProducerAOD::fillTriggerObjectCollections(const edm::Event& i
 
     if (collectionTagsEvent_.find(collectionTag)!=collectionTagsEvent_.end()) {
       const ProductID pid(collections[ic].provenance()->productID());
-      if (offset_.find(pid)!=offset_.end()) {
+      if (!offset_.insert_or_assign(pid,toc_.size()).second) {
 	LogError("TriggerSummaryProducerAOD") << "Duplicate pid: " << pid;
       }
-      offset_[pid]=toc_.size();
       const unsigned int n(collections[ic]->size());
       for (unsigned int i=0; i!=n; ++i) {
 	fillTriggerObject( (*collections[ic])[i] );
@@ -550,7 +549,10 @@ void TriggerSummaryProducerAOD::fillFilterObjectMembers(const edm::Event& iEvent
       } else {
 	LogError("TriggerSummaryProducerAOD") << ost.str();
       }
-    } else if (offset_.find(pid)==offset_.end()) {
+      continue;
+    }
+    const auto offset(offset_.find(pid));
+    if (offset==offset_.end()) {
       const string&    label(iEvent.getProvenance(pid).moduleLabel());
       const string& instance(iEvent.getProvenance(pid).productInstanceName());
       const string&  process(iEvent.getProvenance(pid).processName());
@@ -569,7 +571,7 @@ void TriggerSummaryProducerAOD::fillFilterObjectMembers(const edm::Event& iEvent
 	LogError("TriggerSummaryProducerAOD") << ost.str();
       }
     } else {
-      fillFilterObjectMember(offset_[pid],ids[i],refs[i]);
+      fillFilterObjectMember(offset->second,ids[i],refs[i]);
     }
   }
   return;
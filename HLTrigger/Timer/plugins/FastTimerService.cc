@@ -978,7 +978,7 @@ FastTimerService::FastTimerService(const edm::ParameterSet & config, edm::Activi
 }
 
 void
-FastTimerService::ignoredSignal(const std::string& signal) const
+FastTimerService::ignoredSignal(const char* signal) const
 {
   LogDebug("FastTimerService") << "The FastTimerService received is currently not monitoring the signal \"" << signal << "\".\n";
 }
@@ -55,7 +55,7 @@ public:
   ~FastTimerService() override = default;
 
 private:
-  void ignoredSignal(const std::string& signal) const;
+  void ignoredSignal(const char* signal) const;
   void unsupportedSignal(const std::string& signal) const;
 
   // these signal pairs are not guaranteed to happen in the same thread
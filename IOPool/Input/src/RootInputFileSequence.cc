@@ -9,6 +9,7 @@
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ServiceRegistry.h"
 #include "Utilities/StorageFactory/interface/StorageFactory.h"
 
 #include "TSystem.h"
@@ -32,7 +33,10 @@ namespace edm {
     fileIter_(fileIterEnd_),
     fileIterLastOpened_(fileIterEnd_),
     rootFile_(),
-    indexesIntoFiles_(fileCatalogItems().size()) {
+    indexesIntoFiles_(fileCatalogItems().size()),
+    prefetchNextFile_(false),
+    nextFileIter_(fileIterEnd_),
+    nextFile_() {
   }
 
   std::vector<FileCatalogItem> const&
@@ -234,9 +238,13 @@ namespace edm {
     std::shared_ptr<InputFile> filePtr;
     std::list<std::string> originalInfo;
     try {
-      std::unique_ptr<InputSource::FileOpenSentry> sentry(input ? std::make_unique<InputSource::FileOpenSentry>(*input, lfn_, usedFallback_) : nullptr);
-      std::unique_ptr<char[]> name(gSystem->ExpandPathName(fileName().c_str()));;
-      filePtr = std::make_shared<InputFile>(name.get(), "  Initiating request to open file ", inputType);
+      // A file opened early was announced by its own sentry when it was actually opened.
+      filePtr = takeNextFile();
+      if(!filePtr) {
+        std::unique_ptr<InputSource::FileOpenSentry> sentry(input ? std::make_unique<InputSource::FileOpenSentry>(*input, lfn_, usedFallback_) : nullptr);
+        std::unique_ptr<char[]> name(gSystem->ExpandPathName(fileName().c_str()));;
+        filePtr = std::make_shared<InputFile>(name.get(), "  Initiating request to open file ", inputType);
+      }
     }
     catch (cms::Exception const& e) {
       if(!skipBadFiles) {
@@ -297,6 +305,9 @@ namespace edm {
       fileIterLastOpened_ = fileIter_;
       setIndexIntoFile(currentIndexIntoFile);
       rootFile_->reportOpened(inputTypeName);
+      if(prefetchNextFile_) {
+        startOpeningNextFile(input, inputType);
+      }
     } else {
       InputFile::reportSkippedFile(fileName(), logicalFileName());
       if(!skipBadFiles) {
@@ -307,6 +318,48 @@ namespace edm {
     }
   }
 
+  void
+  RootInputFileSequence::startOpeningNextFile(InputSource* input, InputType inputType) {
+    // Open the next file in the sequence on a separate thread while the current one is being read,
+    // so that the latency of a remote open is hidden.  The open is wrapped in its own FileOpenSentry,
+    // so the open file signals bracket the actual open rather than the later hand-over.
+    // Only the primary name is tried; if the open fails, initTheFile will see the exception and
+    // only then apply the usual fallback and skipping logic.
+    nextFileIter_ = fileIter_ + 1;
+    if(nextFileIter_ == fileIterEnd_ || nextFileIter_->fileName().empty()) {
+      nextFileIter_ = fileIterEnd_;
+      return;
+    }
+    std::unique_ptr<char[]> name(gSystem->ExpandPathName(nextFileIter_->fileName().c_str()));
+    std::string pfn(name.get());
+    std::string lfn(nextFileIter_->logicalFileName().empty() ? nextFileIter_->fileName() : nextFileIter_->logicalFileName());
+    ServiceToken token = ServiceRegistry::instance().presentToken();
+    nextFile_ = std::async(std::launch::async, [pfn, lfn, token, input, inputType]() {
+      ServiceRegistry::Operate operate(token);
+      std::unique_ptr<InputSource::FileOpenSentry> sentry(input ? std::make_unique<InputSource::FileOpenSentry>(*input, lfn, false) : nullptr);
+      return std::make_shared<InputFile>(pfn.c_str(), "  Initiating early request to open file ", inputType);
+    });
+  }
+
+  std::shared_ptr<InputFile>
+  RootInputFileSequence::takeNextFile() {
+    if(!nextFile_.valid()) {
+      return std::shared_ptr<InputFile>();
+    }
+    if(nextFileIter_ == fileIter_) {
+      nextFileIter_ = fileIterEnd_;
+      return nextFile_.get();
+    }
+    // The sequence did not move on to the file opened early (e.g. skipToItem jumped elsewhere).
+    nextFileIter_ = fileIterEnd_;
+    try {
+      nextFile_.get();
+    }
+    catch (...) {
+    }
+    return std::shared_ptr<InputFile>();
+  }
+
   void
   RootInputFileSequence::setIndexIntoFile(size_t index) {
    indexesIntoFiles_[index] = rootFile()->indexIntoFileSharedPtr();
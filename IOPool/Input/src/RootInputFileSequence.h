@@ -13,6 +13,7 @@ RootInputFileSequence: This is an InputSource
 #include "FWCore/Utilities/interface/InputType.h"
 #include "FWCore/Utilities/interface/get_underlying_safe.h"
 
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -74,6 +75,7 @@ namespace edm {
     void setIndexIntoFile(size_t index);
     size_t lfnHash() const {return lfnHash_;}
     bool usedFallback() const {return usedFallback_;}
+    void setPrefetchNextFile(bool prefetch) {prefetchNextFile_ = prefetch;}
 
     std::shared_ptr<RootFile const> rootFile() const {return get_underlying_safe(rootFile_);}
     std::shared_ptr<RootFile>& rootFile() {return get_underlying_safe(rootFile_);}
@@ -89,8 +91,13 @@ namespace edm {
     std::vector<FileCatalogItem>::const_iterator fileIterLastOpened_;
     edm::propagate_const<RootFileSharedPtr> rootFile_;
     std::vector<std::shared_ptr<IndexIntoFile> > indexesIntoFiles_;
+    bool prefetchNextFile_;
+    std::vector<FileCatalogItem>::const_iterator nextFileIter_;
+    std::future<std::shared_ptr<InputFile>> nextFile_;
 
   private:
+    void startOpeningNextFile(InputSource* input, InputType inputType);
+    std::shared_ptr<InputFile> takeNextFile();
     virtual RootFileSharedPtr makeRootFile(std::shared_ptr<InputFile> filePtr) = 0; 
     virtual void initFile_(bool skipBadFiles) = 0;
     virtual void closeFile_() = 0;
@@ -17,6 +17,8 @@
 #include "FWCore/ServiceRegistry/interface/Service.h"
 #include "Utilities/StorageFactory/interface/StorageFactory.h"
 
+#include "TTreeCacheUnzip.h"
+
 namespace edm {
   RootPrimaryFileSequence::RootPrimaryFileSequence(
                 ParameterSet const& pset,
@@ -47,6 +49,13 @@ namespace edm {
     std::string branchesMustMatch = pset.getUntrackedParameter<std::string>("branchesMustMatch", std::string("permissive"));
     if(branchesMustMatch == std::string("strict")) branchesMustMatch_ = BranchDescription::Strict;
 
+    // This must be set before any TTreeCache is created, i.e. before the first file is opened.
+    if(pset.getUntrackedParameter<bool>("enableParallelUnzip", false)) {
+      TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+    }
+
+    setPrefetchNextFile(pset.getUntrackedParameter<bool>("prefetchNextFile", false));
+
     // Prestage the files
     for (setAtFirstFile(); !noMoreFiles(); setAtNextFile()) {
       StorageFactory::get()->stagein(fileName());
@@ -330,6 +339,17 @@ namespace edm {
                      "Note 3: Any sorting occurs independently in each input file (no sorting across input files).");
     desc.addUntracked<unsigned int>("cacheSize", roottree::defaultCacheSize)
         ->setComment("Size of ROOT TTree prefetch cache.  Affects performance.");
+    desc.addUntracked<bool>("enableParallelUnzip", false)
+        ->setComment("True:  Baskets read into the TTree prefetch cache are decompressed in parallel by TBB tasks\n"
+                     "       as soon as the cache is filled, rather than one at a time by the thread asking for a product.\n"
+                     "       Requires ROOT implicit multi-threading (InitRootHandlers 'EnableIMT').\n"
+                     "False: Each basket is decompressed on the thread which reads it.");
+    desc.addUntracked<bool>("prefetchNextFile", false)
+        ->setComment("True:  While a file is being read, the next file in 'fileNames' is opened in the background,\n"
+                     "       hiding the latency of opening remote files. Its open file signals are emitted at that time.\n"
+                     "       The early open only tries the primary name: the catalog fallback is tried only once\n"
+                     "       the sequence reaches that file and finds the early open failed.\n"
+                     "False: Each file is opened only when the previous one has been completely read.");
     std::string defaultString("permissive");
     desc.addUntracked<std::string>("branchesMustMatch", defaultString)
         ->setComment("'strict':     Branches in each input file must match those in the first file.\n"
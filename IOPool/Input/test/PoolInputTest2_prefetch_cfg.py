@@ -0,0 +1,20 @@
+# Configuration file for PoolInputTest2 opening the next input file early
+
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("TESTRECO")
+process.load("FWCore.Framework.test.cmsExceptionsFatal_cff")
+
+process.maxEvents = cms.untracked.PSet(
+    input = cms.untracked.int32(-1)
+)
+process.Analysis = cms.EDAnalyzer("OtherThingAnalyzer")
+
+process.source = cms.Source("PoolSource",
+    setRunNumber = cms.untracked.uint32(621),
+    prefetchNextFile = cms.untracked.bool(True),
+    fileNames = cms.untracked.vstring('file:PoolInputTest.root', 
+        'file:PoolInputOther.root')
+)
+
+process.p = cms.Path(process.Analysis)
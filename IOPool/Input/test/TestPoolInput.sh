@@ -20,6 +20,7 @@ cmsRun --parameter-set ${LOCAL_TEST_DIR}/PrePoolInputTest2_cfg.py || die 'Failur
 cp PoolInputTest.root PoolInputOther.root
 
 cmsRun --parameter-set ${LOCAL_TEST_DIR}/PoolInputTest2_cfg.py || die 'Failure using PoolInputTest2_cfg.py' $?
+cmsRun --parameter-set ${LOCAL_TEST_DIR}/PoolInputTest2_prefetch_cfg.py || die 'Failure using PoolInputTest2_prefetch_cfg.py' $?
 
 cmsRun --parameter-set ${LOCAL_TEST_DIR}/PoolInputTest3_cfg.py || die 'Failure using PoolInputTest3_cfg.py' $?
 
@@ -114,6 +114,7 @@ namespace edm {
       processHistoryRegistry_(),
       parentageIDs_(),
       branchesWithStoredHistory_(),
+      producedEventBranchesFilled_(false),
       wrapperBaseTClass_(TClass::GetClass("edm::WrapperBase")) {
     if (om_->compressionAlgorithm() == std::string("ZLIB")) {
       filePtr_->SetCompressionAlgorithm(ROOT::kZLIB);
@@ -703,15 +704,19 @@ namespace edm {
     // which BranchIDs were produced in this process because
     // we may be storing meta data for only those products
     // We do this only for event products.
-    std::set<BranchID> producedBranches;
-    if(doProvenance && branchType == InEvent && om_->dropMetaData() != PoolOutputModule::DropNone) {
+    // The produced products do not change during the job, so collect them once.
+    static std::set<BranchID> const noBranches;
+    bool const needProducedBranches = doProvenance && branchType == InEvent && om_->dropMetaData() != PoolOutputModule::DropNone;
+    if(needProducedBranches && !producedEventBranchesFilled_) {
       Service<ConstProductRegistry> preg;
       for(auto bd : preg->allBranchDescriptions()) {
         if(bd->produced() && bd->branchType() == InEvent) {
-          producedBranches.insert(bd->branchID());
+          producedEventBranches_.insert(bd->branchID());
         }
       }
+      producedEventBranchesFilled_ = true;
     }
+    std::set<BranchID> const& producedBranches = needProducedBranches ? producedEventBranches_ : noBranches;
 
     // Loop over EDProduct branches, possibly fill the provenance, and write the branch.
     for(auto const& item : items) {
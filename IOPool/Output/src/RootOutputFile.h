@@ -141,6 +141,9 @@ namespace edm {
     ProcessHistoryRegistry processHistoryRegistry_;
     std::map<ParentageID,unsigned int> parentageIDs_;
     std::set<BranchID> branchesWithStoredHistory_;
+    // event products produced in this process, filled on first use
+    std::set<BranchID> producedEventBranches_;
+    bool producedEventBranchesFilled_;
     edm::propagate_const<TClass*> wrapperBaseTClass_;
   };
 
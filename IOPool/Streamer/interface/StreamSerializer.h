@@ -65,6 +65,15 @@ namespace edm
   class ModuleCallingContext;
   class ThinnedAssociationsHelper;
 
+  // Same numbering as ROOT's compression algorithms. The LZ4 and ZSTD
+  // outputs are written as standard frames, so the reader recognizes them
+  // from the frame magic number and needs no extra header field.
+  enum class StreamerCompressionAlgo {
+    ZLIB = 1,
+    LZ4 = 4,
+    ZSTD = 5
+  };
+
   class StreamSerializer
   {
 
@@ -78,7 +87,8 @@ namespace edm
 
     int serializeEvent(EventForOutput const& event, ParameterSetID const& selectorConfig,
                        bool use_compression, int compression_level,
-                       SerializeDataBuffer &data_buffer);
+                       SerializeDataBuffer &data_buffer,
+                       StreamerCompressionAlgo compression_algo = StreamerCompressionAlgo::ZLIB);
 
     /**
      * Compresses the data in the specified input buffer into the
@@ -89,6 +99,14 @@ namespace edm
                                        unsigned int inputSize,
                                        std::vector<unsigned char> &outputBuffer,
                                        int compressionLevel);
+    static unsigned int compressBufferLZ4(unsigned char *inputBuffer,
+                                          unsigned int inputSize,
+                                          std::vector<unsigned char> &outputBuffer,
+                                          int compressionLevel);
+    static unsigned int compressBufferZSTD(unsigned char *inputBuffer,
+                                           unsigned int inputSize,
+                                           std::vector<unsigned char> &outputBuffer,
+                                           int compressionLevel);
 
   private:
 
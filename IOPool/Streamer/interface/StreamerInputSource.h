@@ -54,6 +54,8 @@ namespace edm {
      * specified output buffer.  The inputSize should be set to the size
      * of the compressed data in the inputBuffer.  The expectedFullSize should
      * be set to the original size of the data (before compression).
+     * LZ4 and ZSTD frames are recognized from their magic number, anything
+     * else is treated as zlib data.
      * Returns the actual size of the uncompressed data.
      * Errors are reported by throwing exceptions.
      */
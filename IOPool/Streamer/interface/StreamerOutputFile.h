@@ -56,10 +56,6 @@ class StreamerOutputFile
 
      uint32 adler32() const { return streamerfile_->adler32(); }
 
-  private:
-     void writeEventHeader(const EventMsgView& ineview);
-     void writeStart(const InitMsgView& inview);
-
   private:
      edm::propagate_const<std::shared_ptr<OutputFile>> streamerfile_;
 };
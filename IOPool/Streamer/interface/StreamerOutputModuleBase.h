@@ -47,6 +47,7 @@ namespace edm {
     int maxEventSize_;
     bool useCompression_;
     int compressionLevel_;
+    StreamerCompressionAlgo compressionAlgo_;
 
     // test luminosity sections
     int lumiSectionInterval_;  
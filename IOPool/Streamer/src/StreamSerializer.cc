@@ -22,8 +22,11 @@
 #include "FWCore/ServiceRegistry/interface/Service.h"
 
 #include "zlib.h"
+#include "lz4frame.h"
+#include "zstd.h"
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <vector>
 
@@ -128,7 +131,8 @@ namespace edm {
   int StreamSerializer::serializeEvent(EventForOutput const& event,
                                        ParameterSetID const& selectorConfig,
                                        bool use_compression, int compression_level,
-                                       SerializeDataBuffer& data_buffer) {
+                                       SerializeDataBuffer& data_buffer,
+                                       StreamerCompressionAlgo compression_algo) {
 
     EventSelectionIDVector selectionIDs = event.eventSelectionIDs();
     selectionIDs.push_back(selectorConfig);
@@ -222,8 +226,18 @@ namespace edm {
     // should test if compressed already - should never be?
     //   as double compression can have problems
     if(use_compression) {
-      unsigned int dest_size =
-        compressBuffer(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+      unsigned int dest_size = 0;
+      switch(compression_algo) {
+        case StreamerCompressionAlgo::ZLIB:
+          dest_size = compressBuffer(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+        case StreamerCompressionAlgo::LZ4:
+          dest_size = compressBufferLZ4(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+        case StreamerCompressionAlgo::ZSTD:
+          dest_size = compressBufferZSTD(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+      }
       if(dest_size != 0) {
         data_buffer.ptr_ = &data_buffer.comp_buf_[0]; // reset to point at compressed area
         data_buffer.curr_space_used_ = dest_size;
@@ -277,4 +291,63 @@ namespace edm {
 
     return resultSize;
   }
+
+  /**
+   * Compresses the data in the specified input buffer into the
+   * specified output buffer as an LZ4 frame.  Returns the size of the
+   * compressed data or zero if compression failed.
+   */
+  unsigned int
+  StreamSerializer::compressBufferLZ4(unsigned char *inputBuffer,
+                                      unsigned int inputSize,
+                                      std::vector<unsigned char> &outputBuffer,
+                                      int compressionLevel) {
+    LZ4F_preferences_t prefs;
+    memset(&prefs, 0, sizeof(prefs));
+    prefs.compressionLevel = compressionLevel;
+    prefs.frameInfo.contentSize = inputSize;
+
+    size_t dest_size = LZ4F_compressFrameBound(inputSize, &prefs);
+    if(outputBuffer.size() < dest_size) outputBuffer.resize(dest_size);
+
+    size_t ret = LZ4F_compressFrame(&outputBuffer[0], outputBuffer.size(), inputBuffer,
+                                    inputSize, &prefs);
+    if(LZ4F_isError(ret)) {
+      // compression failed, return a size of zero
+      std::cerr << "LZ4 compression error: " << LZ4F_getErrorName(ret) << std::endl;
+      return 0;
+    }
+    FDEBUG(1) << " original size = " << inputSize
+              << " final size = " << ret
+              << " ratio = " << double(ret)/double(inputSize)
+              << std::endl;
+    return ret;
+  }
+
+  /**
+   * Compresses the data in the specified input buffer into the
+   * specified output buffer as a ZSTD frame.  Returns the size of the
+   * compressed data or zero if compression failed.
+   */
+  unsigned int
+  StreamSerializer::compressBufferZSTD(unsigned char *inputBuffer,
+                                       unsigned int inputSize,
+                                       std::vector<unsigned char> &outputBuffer,
+                                       int compressionLevel) {
+    size_t dest_size = ZSTD_compressBound(inputSize);
+    if(outputBuffer.size() < dest_size) outputBuffer.resize(dest_size);
+
+    size_t ret = ZSTD_compress(&outputBuffer[0], outputBuffer.size(), inputBuffer,
+                               inputSize, compressionLevel);
+    if(ZSTD_isError(ret)) {
+      // compression failed, return a size of zero
+      std::cerr << "ZSTD compression error: " << ZSTD_getErrorName(ret) << std::endl;
+      return 0;
+    }
+    FDEBUG(1) << " original size = " << inputSize
+              << " final size = " << ret
+              << " ratio = " << double(ret)/double(inputSize)
+              << std::endl;
+    return ret;
+  }
 }
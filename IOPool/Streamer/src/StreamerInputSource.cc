@@ -17,6 +17,8 @@
 #include "DataFormats/Provenance/interface/ThinnedAssociationsHelper.h"
 
 #include "zlib.h"
+#include "lz4frame.h"
+#include "zstd.h"
 
 #include "DataFormats/Common/interface/RefCoreStreamer.h"
 #include "FWCore/Utilities/interface/WrappedClassName.h"
@@ -33,6 +35,7 @@
 
 #include <string>
 #include <iostream>
+#include <memory>
 #include <set>
 
 namespace edm {
@@ -347,6 +350,70 @@ namespace edm {
     FDEBUG(10) << "Size = " << eventPrincipal.size() << std::endl;
   }
 
+  namespace {
+    bool hasFrameMagic(unsigned char const* buffer, unsigned int size, uint32_t magic) {
+      if(size < sizeof(uint32_t)) return false;
+      // frame magic numbers are stored little endian
+      uint32_t value = buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | (uint32_t(buffer[3]) << 24);
+      return value == magic;
+    }
+
+    constexpr uint32_t kLZ4FrameMagic = 0x184D2204;
+
+    void checkUncompressedSize(unsigned long origSize, unsigned long uncompressedSize) {
+      if(origSize != uncompressedSize) {
+        // we throw an error and return without event! null pointer
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "mismatch event lengths should be" << origSize << " got "
+          << uncompressedSize << "\n";
+      }
+    }
+
+    unsigned int uncompressLZ4(unsigned char const* inputBuffer,
+                               unsigned int inputSize,
+                               std::vector<unsigned char>& outputBuffer,
+                               unsigned int expectedFullSize) {
+      LZ4F_dctx* context = nullptr;
+      size_t ret = LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
+      if(LZ4F_isError(ret)) {
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "Could not create LZ4 decompression context: " << LZ4F_getErrorName(ret) << "\n ";
+      }
+      std::shared_ptr<LZ4F_dctx> contextGuard(context, [](LZ4F_dctx* c) { LZ4F_freeDecompressionContext(c); });
+
+      outputBuffer.resize(expectedFullSize);
+      size_t uncompressedSize = outputBuffer.size();
+      size_t consumed = inputSize;
+      ret = LZ4F_decompress(context, &outputBuffer[0], &uncompressedSize,
+                            inputBuffer, &consumed, nullptr);
+      if(LZ4F_isError(ret)) {
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "LZ4 error: " << LZ4F_getErrorName(ret) << "\n ";
+      }
+      // a non-zero return means the frame was not complete
+      if(ret != 0 || consumed != inputSize) {
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "truncated LZ4 frame\n ";
+      }
+      checkUncompressedSize(expectedFullSize, uncompressedSize);
+      return uncompressedSize;
+    }
+
+    unsigned int uncompressZSTD(unsigned char const* inputBuffer,
+                                unsigned int inputSize,
+                                std::vector<unsigned char>& outputBuffer,
+                                unsigned int expectedFullSize) {
+      outputBuffer.resize(expectedFullSize);
+      size_t ret = ZSTD_decompress(&outputBuffer[0], outputBuffer.size(), inputBuffer, inputSize);
+      if(ZSTD_isError(ret)) {
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "ZSTD error: " << ZSTD_getErrorName(ret) << "\n ";
+      }
+      checkUncompressedSize(expectedFullSize, ret);
+      return ret;
+    }
+  }
+
   /**
    * Uncompresses the data in the specified input buffer into the
    * specified output buffer.  The inputSize should be set to the size
@@ -360,6 +427,12 @@ namespace edm {
                                         unsigned int inputSize,
                                         std::vector<unsigned char>& outputBuffer,
                                         unsigned int expectedFullSize) {
+    if(hasFrameMagic(inputBuffer, inputSize, kLZ4FrameMagic)) {
+      return uncompressLZ4(inputBuffer, inputSize, outputBuffer, expectedFullSize);
+    }
+    if(hasFrameMagic(inputBuffer, inputSize, ZSTD_MAGICNUMBER)) {
+      return uncompressZSTD(inputBuffer, inputSize, outputBuffer, expectedFullSize);
+    }
     unsigned long origSize = expectedFullSize;
     unsigned long uncompressedSize = expectedFullSize*1.1;
     FDEBUG(1) << "Uncompress: original size = " << origSize
@@ -21,9 +21,9 @@
     /** Offset where current event starts */
     uint64 offset_to_return = streamerfile_->current_offset();
 
-    writeEventHeader(ineview);
-    bool ret = streamerfile_->write((const char*) ineview.eventData(),
-                                    ineview.size() - ineview.headerSize());
+    // header and event data are contiguous in the message buffer
+    bool ret = streamerfile_->write((const char*) ineview.startAddress(),
+                                    ineview.size());
     if (ret) {
       throw cms::Exception("OutputFile", "write(EventMsgView)")
         << "Error writing streamer event data to "
@@ -50,19 +50,6 @@
     return offset_to_return;
   }
 
-  void StreamerOutputFile::writeEventHeader(const EventMsgView& ineview)
-  {
-    bool ret = streamerfile_->write((const char*)
-                                    ineview.startAddress(),
-                                    ineview.headerSize()) ;
-    if (ret) {
-      throw cms::Exception("OutputFile", "writeEventHeader")
-        << "Error writing streamer event data to "
-        << streamerfile_->fileName() << ".  Possibly the output disk "
-        << "is full?" << std::endl;
-    }
-  }
-
   void StreamerOutputFile::write(const InitMsgBuilder& inview)
   {
     InitMsgView tmpView(inview.startAddress());
@@ -71,9 +58,9 @@
 
   void StreamerOutputFile::write(const InitMsgView& inview)
   {
-    writeStart(inview);
-    bool ret = streamerfile_->write((const char*) inview.descData(),
-                                    inview.size() - inview.headerSize());
+    // header and descriptor data are contiguous in the message buffer
+    bool ret = streamerfile_->write((const char*) inview.startAddress(),
+                                    inview.size());
     if (ret) {
       throw cms::Exception("OutputFile", "write(InitMsgView)")
         << "Error writing streamer header data to "
@@ -94,17 +81,3 @@
         << "is full?" << std::endl;
     }
   }
-
-  void StreamerOutputFile::writeStart(const InitMsgView& inview)
-  {
-    bool ret = streamerfile_->write((const char*)
-                                    inview.startAddress(),
-                                    inview.headerSize()) ;
-    if (ret) {
-      throw cms::Exception("OutputFile", "writeStart")
-        << "Error writing streamer header data to "
-        << streamerfile_->fileName() << ".  Possibly the output disk "
-        << "is full?" << std::endl;
-    }
-  }
-
@@ -8,6 +8,7 @@
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 #include "FWCore/Utilities/interface/DebugMacros.h"
+#include "FWCore/Utilities/interface/Exception.h"
 //#include "FWCore/Utilities/interface/Digest.h"
 #include "FWCore/Version/interface/GetReleaseVersion.h"
 #include "DataFormats/Common/interface/TriggerResults.h"
@@ -61,6 +62,7 @@ namespace edm {
     maxEventSize_(ps.getUntrackedParameter<int>("max_event_size")),
     useCompression_(ps.getUntrackedParameter<bool>("use_compression")),
     compressionLevel_(ps.getUntrackedParameter<int>("compression_level")),
+    compressionAlgo_(StreamerCompressionAlgo::ZLIB),
     lumiSectionInterval_(ps.getUntrackedParameter<int>("lumiSection_interval")),
     serializer_(selections_),
     serializeDataBuffer_(),
@@ -81,16 +83,31 @@ namespace edm {
     gettimeofday(&now, &dummyTZ);
     timeInSecSinceUTC = static_cast<double>(now.tv_sec) + (static_cast<double>(now.tv_usec)/1000000.0);
 
+    auto const& algo = ps.getUntrackedParameter<std::string>("compression_algorithm");
+    int maxCompressionLevel = 9;
+    if(algo == "ZLIB") {
+      compressionAlgo_ = StreamerCompressionAlgo::ZLIB;
+    } else if(algo == "LZ4") {
+      compressionAlgo_ = StreamerCompressionAlgo::LZ4;
+      maxCompressionLevel = 12;
+    } else if(algo == "ZSTD") {
+      compressionAlgo_ = StreamerCompressionAlgo::ZSTD;
+      maxCompressionLevel = 19;
+    } else {
+      throw cms::Exception("StreamerOutputModuleBase", "Compression algorithm")
+        << "Unknown compression_algorithm '" << algo << "'. Legal values are 'ZLIB', 'LZ4' and 'ZSTD'.";
+    }
+
     if(useCompression_ == true) {
       if(compressionLevel_ <= 0) {
         FDEBUG(9) << "Compression Level = " << compressionLevel_
                   << " no compression" << std::endl;
         compressionLevel_ = 0;
         useCompression_ = false;
-      } else if(compressionLevel_ > 9) {
+      } else if(compressionLevel_ > maxCompressionLevel) {
         FDEBUG(9) << "Compression Level = " << compressionLevel_
-                  << " using max compression level 9" << std::endl;
-        compressionLevel_ = 9;
+                  << " using max compression level " << maxCompressionLevel << std::endl;
+        compressionLevel_ = maxCompressionLevel;
       }
     }
     serializeDataBuffer_.bufs_.resize(maxEventSize_);
@@ -264,7 +281,7 @@ namespace edm {
       setLumiSection();
     }
 
-    serializer_.serializeEvent(e, selectorConfig(), useCompression_, compressionLevel_, serializeDataBuffer_);
+    serializer_.serializeEvent(e, selectorConfig(), useCompression_, compressionLevel_, serializeDataBuffer_, compressionAlgo_);
 
     // resize bufs_ to reflect space used in serializer_ + header
     // I just added an overhead for header of 50000 for now
@@ -304,7 +321,10 @@ namespace edm {
     desc.addUntracked<bool>("use_compression", true)
         ->setComment("If True, compression will be used to write streamer file.");
     desc.addUntracked<int>("compression_level", 1)
-        ->setComment("ROOT compression level to use.");
+        ->setComment("Compression level to use (1-9 for ZLIB, 1-12 for LZ4, 1-19 for ZSTD).");
+    desc.addUntracked<std::string>("compression_algorithm", "ZLIB")
+        ->setComment("Compression algorithm to use: 'ZLIB', 'LZ4' or 'ZSTD'.\n"
+                     "Readers detect the algorithm from the compressed data.");
     desc.addUntracked<int>("lumiSection_interval", 0)
         ->setComment("If 0, use lumi section number from event.\n"
                      "If not 0, the interval in seconds between fake lumi sections.");
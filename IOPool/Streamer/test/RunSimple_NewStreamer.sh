@@ -21,6 +21,9 @@ cmsRun --parameter-set NewStreamIn_cfg.py  > in  2>&1 || die "cmsRun NewStreamIn
 cmsRun --parameter-set NewStreamIn2_cfg.py  > in2  2>&1 || die "cmsRun NewStreamIn2_cfg.py" $?
 cmsRun --parameter-set NewStreamCopy_cfg.py  > copy  2>&1 || die "cmsRun NewStreamCopy_cfg.py" $?
 cmsRun --parameter-set NewStreamCopy2_cfg.py  > copy2  2>&1 || die "cmsRun NewStreamCopy2_cfg.py" $?
+cmsRun --parameter-set NewStreamOutAlgos_cfg.py > outAlgos 2>&1 || die "cmsRun NewStreamOutAlgos_cfg.py" $?
+cmsRun --parameter-set NewStreamInLZ4_cfg.py  > inLZ4  2>&1 || die "cmsRun NewStreamInLZ4_cfg.py" $?
+cmsRun --parameter-set NewStreamInZSTD_cfg.py  > inZSTD  2>&1 || die "cmsRun NewStreamInZSTD_cfg.py" $?
 
 # echo "CHECKSUM = 1" > out
 # echo "CHECKSUM = 1" > in
@@ -30,6 +33,8 @@ ANS_OUT=`grep CHECKSUM out`
 ANS_IN=`grep CHECKSUM in`
 ANS_IN2=`grep CHECKSUM in2`
 ANS_COPY=`grep CHECKSUM copy`
+ANS_IN_LZ4=`grep CHECKSUM inLZ4`
+ANS_IN_ZSTD=`grep CHECKSUM inZSTD`
 
 if [ "${ANS_OUT_SIZE}" == "0" ]
 then
@@ -55,5 +60,17 @@ then
     RC=1
 fi
 
+if [ "${ANS_OUT}" != "${ANS_IN_LZ4}" ]
+then
+    echo "New Stream Test Failed (out!=inLZ4)"
+    RC=1
+fi
+
+if [ "${ANS_OUT}" != "${ANS_IN_ZSTD}" ]
+then
+    echo "New Stream Test Failed (out!=inZSTD)"
+    RC=1
+fi
+
 #rm -rf ${OUTDIR}
 exit ${RC}
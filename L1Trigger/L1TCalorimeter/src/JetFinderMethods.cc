@@ -61,50 +61,51 @@ namespace l1t {
       int neighborSE_et = 0;
       unsigned int nNeighbors = 0;
       for(std::vector<CaloRegion>::const_iterator neighbor = regions->begin(); neighbor != regions->end(); neighbor++) {
+	const int dPhi = deltaGctPhi(*region, *neighbor);
 	int neighborET = neighbor->hwPt(); //regionPhysicalEt(*neighbor);
-	if(deltaGctPhi(*region, *neighbor) == 1 &&
+	if(dPhi == 1 &&
 	   (region->hwEta()    ) == neighbor->hwEta()) {
 	  neighborN_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta()    ) == neighbor->hwEta()) {
 	  neighborS_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 0 &&
+	else if(dPhi == 0 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborE_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 0 &&
+	else if(dPhi == 0 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 1 &&
+	else if(dPhi == 1 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborNE_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborSW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 1 &&
+	else if(dPhi == 1 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborNW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborSE_et = neighborET;
 	  nNeighbors++;
@@ -182,50 +183,51 @@ namespace l1t {
       int neighborSE_et = 0;
       unsigned int nNeighbors = 0;
       for(std::vector<CaloRegion>::const_iterator neighbor = regions->begin(); neighbor != regions->end(); neighbor++) {
+	const int dPhi = deltaGctPhi(*region, *neighbor);
 	int neighborET = neighbor->hwPt(); //regionPhysicalEt(*neighbor);
-	if(deltaGctPhi(*region, *neighbor) == 1 &&
+	if(dPhi == 1 &&
 	   (region->hwEta()    ) == neighbor->hwEta()) {
 	  neighborN_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta()    ) == neighbor->hwEta()) {
 	  neighborS_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 0 &&
+	else if(dPhi == 0 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborE_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 0 &&
+	else if(dPhi == 0 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 1 &&
+	else if(dPhi == 1 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborNE_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborSW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 1 &&
+	else if(dPhi == 1 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborNW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborSE_et = neighborET;
 	  nNeighbors++;
@@ -284,53 +286,54 @@ namespace l1t {
       int neighborSE_et = 0;
       unsigned int nNeighbors = 0;
       for(std::vector<CaloRegion>::const_iterator neighbor = regions->begin(); neighbor != regions->end(); neighbor++) {
+	const int dPhi = deltaGctPhi(*region, *neighbor);
 	int neighborET = neighbor->hwPt();
 	int subEta2 = neighbor->hwEta();
 	if((etaMask & (1<<subEta2))>>subEta2) neighborET = 0;
 
-	if(deltaGctPhi(*region, *neighbor) == 1 &&
+	if(dPhi == 1 &&
 	   (region->hwEta()    ) == neighbor->hwEta()) {
 	  neighborN_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta()    ) == neighbor->hwEta()) {
 	  neighborS_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 0 &&
+	else if(dPhi == 0 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborE_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 0 &&
+	else if(dPhi == 0 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 1 &&
+	else if(dPhi == 1 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborNE_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborSW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == 1 &&
+	else if(dPhi == 1 &&
 		(region->hwEta() - 1) == neighbor->hwEta()) {
 	  neighborNW_et = neighborET;
 	  nNeighbors++;
 	  continue;
 	}
-	else if(deltaGctPhi(*region, *neighbor) == -1 &&
+	else if(dPhi == -1 &&
 		(region->hwEta() + 1) == neighbor->hwEta()) {
 	  neighborSE_et = neighborET;
 	  nNeighbors++;
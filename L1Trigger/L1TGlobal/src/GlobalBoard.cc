@@ -21,6 +21,7 @@
 
 // system include files
 #include <ext/hash_map>
+#include <utility>
 
 // user include files
 #include "DataFormats/L1TGlobal/interface/GlobalObjectMap.h"
@@ -473,8 +474,7 @@ void l1t::GlobalBoard::runGTL(
     const std::vector<ConditionMap>& conditionMap = m_l1GtMenu->gtConditionMap();
     const AlgorithmMap& algorithmMap = m_l1GtMenu->gtAlgorithmMap();
     const GlobalScales& gtScales = m_l1GtMenu->gtScales();
-    const std::string scaleSetName = gtScales.getScalesName();
-    LogDebug("L1TGlobal") << " L1 Menu Scales -- Set Name: " << scaleSetName << std::endl;
+    LogDebug("L1TGlobal") << " L1 Menu Scales -- Set Name: " << gtScales.getScalesName() << std::endl;
 
     // Reset AlgBlk for this bx
      m_uGtAlgBlk.reset();
@@ -853,11 +853,12 @@ void l1t::GlobalBoard::runGTL(
         if (produceL1GtObjectMapRecord && (iBxInEvent == 0)) {
 
 	  std::vector<L1TObjectTypeInCond> otypes;	  
+	  otypes.reserve(gtAlg.operandTokenVector().size());
 	  for (auto iop = gtAlg.operandTokenVector().begin(); iop != gtAlg.operandTokenVector().end(); ++iop){
 	    //cout << "INFO:  operand name:  " << iop->tokenName << "\n";
 	    int myChip = -1;
 	    int found =0;
-	    L1TObjectTypeInCond otype;	      
+	    const L1TObjectTypeInCond* otype = nullptr;
 	    for (auto imap = conditionMap.begin(); imap != conditionMap.end(); imap++) {
 	      myChip++;
 	      auto match = imap->find(iop->tokenName);
@@ -866,9 +867,9 @@ void l1t::GlobalBoard::runGTL(
 		found = 1;
 		//cout << "DEBUG: found match for " << iop->tokenName << " at " << match->first << "\n";
 				
-		otype = match->second->objectType();
+		otype = &(match->second->objectType());
 		
-		for (auto itype = otype.begin(); itype != otype.end() ; itype++){
+		for (auto itype = otype->begin(); itype != otype->end() ; itype++){
 		  //cout << "type:  " << *itype << "\n";
 		}
 	      }	      
@@ -876,7 +877,7 @@ void l1t::GlobalBoard::runGTL(
 	    if (!found){
 	      edm::LogWarning("L1TGlobal") << "\n Failed to find match for operand token " << iop->tokenName << "\n";
 	    } else {
-	      otypes.push_back(otype);
+	      otypes.push_back(*otype);
 	    }
 	  }
 
@@ -898,7 +899,7 @@ void l1t::GlobalBoard::runGTL(
 	    LogTrace("L1TGlobal")  << myCout1.str() << std::endl;
 	  }
 
-	  objMapVec.push_back(objMap);
+	  objMapVec.push_back(std::move(objMap));
 
         }
 
@@ -386,6 +386,7 @@ void HGCalClusteringImpl::removeUnconnectedTCinCluster( l1t::HGCalCluster & clus
     
     /* distances from the seed */
     vector<pair<edm::Ptr<l1t::HGCalTriggerCell>,float>> distances;
+    distances.reserve( constituents.size() );
     for( const auto & id_tc : constituents )
     {
         Basic3DVector<float> tcCentre( id_tc.second->position() );
@@ -37,19 +37,29 @@ void PtLUTReader::read(const std::string& lut_full_path) {
   ptlut_.reserve(PTLUT_SIZE);
 
   typedef uint64_t full_word_t;
-  full_word_t full_word;
   full_word_t sub_word[4] = {0, 0, 0, 0};
 
-  while (infile.read(reinterpret_cast<char*>(&full_word), sizeof(full_word_t))) {
-    sub_word[0] = (full_word>>0)      & 0x1FF;  // 9-bit
-    sub_word[1] = (full_word>>9)      & 0x1FF;
-    sub_word[2] = (full_word>>32)     & 0x1FF;
-    sub_word[3] = (full_word>>(32+9)) & 0x1FF;
-
-    ptlut_.push_back(sub_word[0]);
-    ptlut_.push_back(sub_word[1]);
-    ptlut_.push_back(sub_word[2]);
-    ptlut_.push_back(sub_word[3]);
+  // Read in blocks of words rather than one word per stream call; a
+  // trailing partial word is dropped, as before
+  const size_t block_size = 1<<16;
+  std::vector<full_word_t> block(block_size);
+
+  while (infile) {
+    infile.read(reinterpret_cast<char*>(block.data()), block_size * sizeof(full_word_t));
+    const size_t nwords = infile.gcount() / sizeof(full_word_t);
+
+    for (size_t i = 0; i < nwords; ++i) {
+      const full_word_t full_word = block[i];
+      sub_word[0] = (full_word>>0)      & 0x1FF;  // 9-bit
+      sub_word[1] = (full_word>>9)      & 0x1FF;
+      sub_word[2] = (full_word>>32)     & 0x1FF;
+      sub_word[3] = (full_word>>(32+9)) & 0x1FF;
+
+      ptlut_.push_back(sub_word[0]);
+      ptlut_.push_back(sub_word[1]);
+      ptlut_.push_back(sub_word[2]);
+      ptlut_.push_back(sub_word[3]);
+    }
   }
   infile.close();
 
@@ -59,10 +59,10 @@ class TTStubAlgorithm_official : public TTStubAlgorithm< T >
 			      bool aPerformZMatchingPS, bool aPerformZMatching2S )
       : TTStubAlgorithm< T >( theTrackerGeom, theTrackerTopo, __func__ )
     {
-      barrelCut = setBarrelCut;
-      ringCut = setRingCut;
-      tiltedCut = setTiltedCut;
-      barrelNTilt = setBarrelNTilt;
+      barrelCut = std::move(setBarrelCut);
+      ringCut = std::move(setRingCut);
+      tiltedCut = std::move(setTiltedCut);
+      barrelNTilt = std::move(setBarrelNTilt);
       mPerformZMatchingPS = aPerformZMatchingPS;
       mPerformZMatching2S = aPerformZMatching2S;
     }
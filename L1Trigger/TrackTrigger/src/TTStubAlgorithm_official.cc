@@ -170,6 +170,7 @@ template< >
     unsigned int numSmallGroups = numAllowed - numLargeGroups;
 
     std::vector<unsigned int> groups;
+    groups.reserve(numAllowed);
 
     // At the end we have
     //
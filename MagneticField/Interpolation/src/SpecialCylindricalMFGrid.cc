@@ -121,16 +121,17 @@ void SpecialCylindricalMFGrid::toGridFrame( const LocalPoint& p,
 					    double& a, double& b, double& c) const
 {
   GlobalPoint gp = frame().toGlobal(p);
+  const auto phi = gp.phi(); // computed once, used for sinPhi and for b
   double sinPhi; // sin or cos depending on wether we are at phi=0 or phi=pi/2
   if (sector1) {
-    sinPhi = cos(gp.phi());
+    sinPhi = cos(phi);
   } else {
-    sinPhi = sin(gp.phi());
+    sinPhi = sin(phi);
   }
   a = (gp.perp()-startingPoint(sinPhi))/stepSize(sinPhi);
   // FIXME: "OLD" convention of phi.
   // b = Geom::pi() - gp.phi();
-  b = gp.phi();
+  b = phi;
   c = gp.z();
 
 #ifdef DEBUG_GRID
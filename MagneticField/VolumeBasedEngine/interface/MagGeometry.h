@@ -12,7 +12,6 @@
 #include "DetectorDescription/Core/interface/DDCompactView.h"
 
 #include <vector>
-#include <atomic>
 
 class MagBLayer;
 class MagESector;
@@ -62,7 +61,8 @@ private:
 
   bool inBarrel(const GlobalPoint& gp) const;
 
-  mutable std::atomic<MagVolume const*> lastVolume; // Cache last volume found
+  // Unique id of this instance, used to key the per-thread cache of the last volume found
+  const unsigned long long cacheId;
 
   std::vector<MagBLayer const*> theBLayers;
   std::vector<MagESector const*> theESectors;
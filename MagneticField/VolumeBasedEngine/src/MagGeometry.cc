@@ -17,9 +17,26 @@
 #include "MagneticField/Layers/interface/MagVerbosity.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 
+#include <atomic>
+
 using namespace std;
 using namespace edm;
 
+namespace {
+  // Ids of the MagGeometry instances; never reused, so that a stale cache
+  // entry of a deleted instance can not be picked up by a new one.
+  std::atomic<unsigned long long> nextCacheId{1};
+
+  // Per-thread cache of the last volume found, with a few slots so that
+  // threads alternating between field maps do not evict each other.
+  struct LastVolumeCache {
+    static constexpr unsigned int nSlots = 4;
+    unsigned long long id[nSlots] = {};
+    MagVolume const* volume[nSlots] = {};
+  };
+  thread_local LastVolumeCache lastVolumeCache;
+}
+
 MagGeometry::MagGeometry(int geomVersion, const std::vector<MagBLayer *>& tbl,
 			 const std::vector<MagESector *>& tes,
 			 const std::vector<MagVolume6Faces*>& tbv,
@@ -31,7 +48,7 @@ MagGeometry::MagGeometry(int geomVersion, const std::vector<MagBLayer const*>& t
 			 const std::vector<MagESector const*>& tes,
 			 const std::vector<MagVolume6Faces const*>& tbv,
 			 const std::vector<MagVolume6Faces const*>& tev) : 
-  lastVolume(nullptr), theBLayers(tbl), theESectors(tes), theBVolumes(tbv), theEVolumes(tev), cacheLastVolume(true), geometryVersion(geomVersion)
+  cacheId(nextCacheId.fetch_add(1,std::memory_order_relaxed)), theBLayers(tbl), theESectors(tes), theBVolumes(tbv), theEVolumes(tev), cacheLastVolume(true), geometryVersion(geomVersion)
 {
   vector<double> rBorders;
 
@@ -135,8 +152,9 @@ MagGeometry::findVolume1(const GlobalPoint & gp, double tolerance) const {
 // Use hierarchical structure for fast lookup.
 MagVolume const* 
 MagGeometry::findVolume(const GlobalPoint & gp, double tolerance) const{
-  // Check volume cache
-  auto lastVolumeCheck = lastVolume.load(std::memory_order_acquire);
+  // Check volume cache of this thread
+  const unsigned int slot = cacheId % LastVolumeCache::nSlots;
+  MagVolume const* lastVolumeCheck = (lastVolumeCache.id[slot]==cacheId ? lastVolumeCache.volume[slot] : nullptr);
   if (lastVolumeCheck!=nullptr && lastVolumeCheck->inside(gp)){
     return lastVolumeCheck;
   }
@@ -175,7 +193,10 @@ MagGeometry::findVolume(const GlobalPoint & gp, double tolerance) const{
     result = findVolume(gp, 0.03);
   }
 
-  if (cacheLastVolume) lastVolume.store(result,std::memory_order_release);
+  if (cacheLastVolume) {
+    lastVolumeCache.id[slot] = cacheId;
+    lastVolumeCache.volume[slot] = result;
+  }
 
   return result;
 }
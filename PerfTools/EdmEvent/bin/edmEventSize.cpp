@@ -38,6 +38,8 @@ static const char * const kAlphabeticOrderOpt ="alphabetic-order";
 static const char * const kAlphabeticOrderCommandOpt ="alphabetic-order,A";
 static const char * const kFormatNamesOpt ="format-names";
 static const char * const kFormatNamesCommandOpt ="format-names,F";
+static const char * const kReadTimeOpt ="read-time";
+static const char * const kReadTimeCommandOpt ="read-time,r";
 
 int main( int argc, char * argv[] ) {
   using namespace boost::program_options;
@@ -60,6 +62,7 @@ int main( int argc, char * argv[] ) {
     ( kPlotCommandOpt, value<string>(), "produce a summary plot" )
     ( kPlotTopCommandOpt, value<int>(), "plot only the <arg> top size branches" )
     ( kSavePlotCommandOpt, value<string>(), "save plot into root file <arg>" )
+    ( kReadTimeCommandOpt, value<int>(), "measure the average read time of each branch over the first <arg> events (negative: all events)" )
     ( kVerboseCommandOpt, "verbose printout" );
 
   positional_options_description p;
@@ -111,6 +114,15 @@ int main( int argc, char * argv[] ) {
     return error.code;
   } 
 
+  if ( vm.count( kReadTimeOpt ) ) {
+    try {
+      me.measureReadTime(treeName,vm[kReadTimeOpt].as<int>());
+    } catch(perftools::EdmEventSize::Error const & error) {
+      std::cerr <<  programName << ":" << error.descr << std::endl;
+      return error.code;
+    }
+  }
+
   if ( vm.count( kFormatNamesOpt) )
     me.formatNames();
 
@@ -36,15 +36,18 @@ namespace perftools {
     struct BranchRecord {
       BranchRecord() : 
 	compr_size(0.),  
-	uncompr_size(0.) {}
+	uncompr_size(0.),
+	read_time(0.) {}
       BranchRecord(std::string const & iname,
 		   double compr,  double uncompr) : 
 	fullName(iname), name(iname), 
-	compr_size(compr), uncompr_size(uncompr){}
+	compr_size(compr), uncompr_size(uncompr), read_time(0.){}
       std::string fullName;
       std::string name;
       double compr_size;
       double uncompr_size;
+      /// average time to read (decompress and stream) the branch, in ms/event
+      double read_time;
     };
 
     typedef std::vector<BranchRecord> Branches;
@@ -57,6 +60,10 @@ namespace perftools {
     /// read file, compute branch size, sort by size
     void parseFile(std::string const & fileName, std::string const & treeName="Events");
 
+    /// replay the file and measure the average read time of each branch
+    /// over the first maxEvents events (all if negative)
+    void measureReadTime(std::string const & treeName="Events", int maxEvents=-1);
+
     /// sort by name
     void sortAlpha();
     
@@ -72,6 +79,7 @@ namespace perftools {
   private:
     std::string m_fileName;
     int m_nEvents;
+    bool m_readTimeMeasured;
     Branches m_branches;
 
   };
@@ -10,6 +10,7 @@
 #include <ostream>
 #include <limits>
 #include <cassert>
+#include <chrono>
 
 #include "Rtypes.h"
 #include "TROOT.h"
@@ -70,16 +71,17 @@ namespace {
 namespace perftools {
 
   EdmEventSize::EdmEventSize() : 
-    m_nEvents(0) {}
+    m_nEvents(0), m_readTimeMeasured(false) {}
   
   EdmEventSize::EdmEventSize(std::string const & fileName, std::string const & treeName ) : 
-    m_nEvents(0) {
+    m_nEvents(0), m_readTimeMeasured(false) {
     parseFile(fileName);
   }
   
   void EdmEventSize::parseFile(std::string const & fileName, std::string const & treeName) {
     m_fileName = fileName;
     m_branches.clear();
+    m_readTimeMeasured = false;
 
     TFile * file = TFile::Open( fileName.c_str() );
     if( file==nullptr  || ( !(*file).IsOpen() ) )
@@ -120,6 +122,38 @@ namespace perftools {
 
   }
   
+  void EdmEventSize::measureReadTime(std::string const & treeName, int maxEvents) {
+    TFile * file = TFile::Open( m_fileName.c_str() );
+    if( file==nullptr  || ( !(*file).IsOpen() ) )
+      throw Error( "unable to open data file " + m_fileName, 7002);
+
+    TTree * events = dynamic_cast<TTree*> (file->Get(treeName.c_str() ));
+    if ( events == nullptr )
+      throw Error("no TTree \"" + treeName + "\" found in file: " + m_fileName, 7003);
+
+    Long64_t nEntries = events->GetEntries();
+    if ( maxEvents >= 0 && maxEvents < nEntries ) nEntries = maxEvents;
+    if ( nEntries == 0 )
+      throw Error("tree \"" + treeName + "\" in file " + m_fileName + " contains no Events", 7005);
+
+    // each branch is read on its own, so its time includes basket reading, decompression
+    // and streaming of that product only
+    for( auto & br : m_branches ) {
+      TBranch * b = events->GetBranch( br.fullName.c_str() );
+      if ( b == nullptr ) continue;
+      auto start = std::chrono::steady_clock::now();
+      for( Long64_t i = 0; i < nEntries; ++i )
+	b->GetEntry( i );
+      std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+      br.read_time = elapsed.count()/double(nEntries);
+      b->DropBaskets( "all" );
+    }
+    m_readTimeMeasured = true;
+
+    file->Close();
+    delete file;
+  }
+  
   void EdmEventSize::sortAlpha() {
     std::sort(m_branches.begin(),m_branches.end(), 
 	      boost::bind(std::less<std::string>(),
@@ -160,16 +194,22 @@ namespace perftools {
     void dump(std::ostream& co, EdmEventSize::BranchRecord const & br) {
       co << br.name << " " <<  br.uncompr_size <<  " " << br.compr_size << "\n"; 
     }
+
+    void dumpWithTime(std::ostream& co, EdmEventSize::BranchRecord const & br) {
+      co << br.name << " " <<  br.uncompr_size <<  " " << br.compr_size << " " << br.read_time << "\n"; 
+    }
   }
 
   
   void EdmEventSize::dump(std::ostream & co, bool header) const {
     if (header) {
       co << "File " << m_fileName << " Events " << m_nEvents << "\n";
-      co <<"Branch Name | Average Uncompressed Size (Bytes/Event) | Average Compressed Size (Bytes/Event) \n";
+      co <<"Branch Name | Average Uncompressed Size (Bytes/Event) | Average Compressed Size (Bytes/Event)";
+      if (m_readTimeMeasured) co << " | Average Read Time (ms/Event)";
+      co << " \n";
     }
     std::for_each(m_branches.begin(),m_branches.end(),
-		  boost::bind(detail::dump,boost::ref(co),_1));
+		  boost::bind(m_readTimeMeasured ? detail::dumpWithTime : detail::dump,boost::ref(co),_1));
   }
 
   namespace detail {
@@ -34,8 +34,9 @@ class TableOutputBranches {
     struct NamedBranchPtr {
         std::string name, title, rootTypeCode;
         TBranch * branch;
+        int idx; // column index in the last table seen, revalidated by name on each fill
         NamedBranchPtr(const std::string & aname, const std::string & atitle, const std::string & rootType, TBranch *branchptr = nullptr) : 
-            name(aname), title(atitle), rootTypeCode(rootType), branch(branchptr) {}
+            name(aname), title(atitle), rootTypeCode(rootType), branch(branchptr), idx(-1) {}
     };
     TBranch * m_counterBranch;
     std::vector<NamedBranchPtr> m_floatBranches;
@@ -45,7 +46,10 @@ class TableOutputBranches {
 
     template<typename T>
     void fillColumn(NamedBranchPtr & pair, const nanoaod::FlatTable & tab) {
-        int idx = tab.columnIndex(pair.name);
+        int idx = pair.idx;
+        if (idx == -1 || unsigned(idx) >= tab.nColumns() || tab.columnName(idx) != pair.name) {
+            idx = pair.idx = tab.columnIndex(pair.name);
+        }
         if (idx == -1) throw cms::Exception("LogicError", "Missing column in input for "+m_baseName+"_"+pair.name);
         pair.branch->SetAddress( const_cast<T *>(& tab.columnData<T>(idx).front() ) ); // SetAddress should take a const * !
     }
@@ -53,6 +53,7 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 
 using namespace pat;
@@ -500,9 +501,21 @@ void PATMuonProducer::produce(edm::Event & iEvent, const edm::EventSetup & iSetu
       //tcMETmuCorValueMap  = *tcMETmuCorValueMap_h;
     }
 
+    // PF ECAL energy by muon key (the last PF candidate wins, as in a full scan),
+    // collected once per event instead of once per muon
+    std::unordered_map<size_t, double> pfEcalEnergyByKey;
+    edm::ProductID pfMuonRefId;
+    bool pfMuonRefIdsDiffer = false;
     if (embedPfEcalEnergy_) {
         // get the PFCandidates of type muons
         iEvent.getByToken(pfMuonToken_, pfMuons);
+        for (const reco::PFCandidate &pfmu : *pfMuons) {
+            if (pfmu.muonRef().isNonnull()) {
+                if (pfEcalEnergyByKey.empty()) pfMuonRefId = pfmu.muonRef().id();
+                else if (pfmu.muonRef().id() != pfMuonRefId) pfMuonRefIdsDiffer = true;
+                pfEcalEnergyByKey[pfmu.muonRef().key()] = pfmu.ecalEnergy();
+            }
+        }
     }
 
     for (edm::View<reco::Muon>::const_iterator itMuon = muons->begin(); itMuon != muons->end(); ++itMuon) {
@@ -583,13 +596,12 @@ void PATMuonProducer::produce(edm::Event & iEvent, const edm::EventSetup & iSetu
 
       if (embedPfEcalEnergy_) {
           aMuon.setPfEcalEnergy(-99.0);
-          for (const reco::PFCandidate &pfmu : *pfMuons) {
-              if (pfmu.muonRef().isNonnull()) {
-                  if (pfmu.muonRef().id() != muonRef.id()) throw cms::Exception("Configuration") << "Muon reference within PF candidates does not point to the muon collection." << std::endl;
-                  if (pfmu.muonRef().key() == muonRef.key()) {
-                      aMuon.setPfEcalEnergy(pfmu.ecalEnergy());
-                  }
-              } 
+          if (!pfEcalEnergyByKey.empty()) {
+              if (pfMuonRefIdsDiffer || pfMuonRefId != muonRef.id()) throw cms::Exception("Configuration") << "Muon reference within PF candidates does not point to the muon collection." << std::endl;
+              auto found = pfEcalEnergyByKey.find(muonRef.key());
+              if (found != pfEcalEnergyByKey.end()) {
+                  aMuon.setPfEcalEnergy(found->second);
+              }
           }
       }
       // MC info
@@ -235,6 +235,7 @@ void run(Session* session, const std::vector<std::string>& inputNames,
     }
 
     NamedTensorList inputs;
+    inputs.reserve(inputNames.size());
     for (size_t i = 0; i < inputNames.size(); i++)
     {
         inputs.push_back(NamedTensor(inputNames[i], inputTensors[i]));
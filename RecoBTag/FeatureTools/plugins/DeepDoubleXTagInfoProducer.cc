@@ -136,6 +136,13 @@ void DeepDoubleXTagInfoProducer::produce(edm::Event& iEvent,
     iSetup.get<TransientTrackRecord>().get("TransientTrackBuilder",
         track_builder);
 
+    // the secondary vertices sorted by dxy, the same for all jets
+    auto svs_sorted = *svs;
+    std::sort(svs_sorted.begin(), svs_sorted.end(),
+        [&pv](const auto& sva, const auto& svb) {
+            return btagbtvdeep::sv_vertex_comparator(sva, svb, pv);
+        });
+
     for (std::size_t jet_n = 0; jet_n < jets->size(); jet_n++)
     {
 
@@ -187,13 +194,6 @@ void DeepDoubleXTagInfoProducer::produce(edm::Event& iEvent,
         btagbtvdeep::doubleBTagToFeatures(tag_info_vars,
             features.tag_info_features);
 
-        // copy which will be sorted
-        auto svs_sorted = *svs;
-        // sort by dxy
-        std::sort(svs_sorted.begin(), svs_sorted.end(),
-            [&pv](const auto& sva, const auto& svb) {
-                return btagbtvdeep::sv_vertex_comparator(sva, svb, pv);
-            });
         // fill features from secondary vertices
         for (const auto& sv : svs_sorted)
         {
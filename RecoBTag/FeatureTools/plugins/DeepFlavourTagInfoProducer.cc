@@ -168,6 +168,19 @@ void DeepFlavourTagInfoProducer::produce(edm::Event& iEvent, const edm::EventSet
   edm::ESHandle<TransientTrackBuilder> track_builder;
   iSetup.get<TransientTrackRecord>().get("TransientTrackBuilder", track_builder);
 
+  // the secondary vertices sorted by dxy, the same for all jets
+  auto svs_sorted = *svs;
+  std::sort(svs_sorted.begin(), svs_sorted.end(),
+            [&pv](const auto & sva, const auto &svb)
+            { return btagbtvdeep::sv_vertex_comparator(sva, svb, pv); });
+
+  // track selection of the tag info computer, the same for all jets
+  const edm::Provenance *prov = shallow_tag_infos.provenance();
+  const edm::ParameterSet& psetFromProvenance = edm::parameterSet(*prov);
+  double negative_cut = ( ( psetFromProvenance.getParameter<edm::ParameterSet>("computer")
+			    ).getParameter<edm::ParameterSet>("trackSelection")
+			  ).getParameter<double>("sip3dSigMax");
+
   for (std::size_t jet_n = 0; jet_n <  jets->size(); jet_n++) {
 
     // create data containing structure
@@ -210,12 +223,6 @@ void DeepFlavourTagInfoProducer::produce(edm::Event& iEvent, const edm::EventSet
     const auto & tag_info_vars = tag_info.taggingVariables();
     btagbtvdeep::bTagToFeatures(tag_info_vars, features.tag_info_features);
 
-    // copy which will be sorted
-    auto svs_sorted = *svs;
-    // sort by dxy
-    std::sort(svs_sorted.begin(), svs_sorted.end(),
-              [&pv](const auto & sva, const auto &svb)
-              { return btagbtvdeep::sv_vertex_comparator(sva, svb, pv); });
     // fill features from secondary vertices
     for (const auto & sv : svs_sorted) {
       if (reco::deltaR2(sv, jet_dir) > (jet_radius_*jet_radius_)) continue;
@@ -274,11 +281,6 @@ void DeepFlavourTagInfoProducer::produce(edm::Event& iEvent, const edm::EventSet
     features.n_pf_features.resize(n_sorted.size());
 
 
-    const edm::Provenance *prov = shallow_tag_infos.provenance();
-    const edm::ParameterSet& psetFromProvenance = edm::parameterSet(*prov);
-    double negative_cut = ( ( psetFromProvenance.getParameter<edm::ParameterSet>("computer")
-			      ).getParameter<edm::ParameterSet>("trackSelection")
-			    ).getParameter<double>("sip3dSigMax");
 
   for (unsigned int i = 0; i <  jet.numberOfDaughters(); i++){
 
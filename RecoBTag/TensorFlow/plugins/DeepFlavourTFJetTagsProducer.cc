@@ -230,6 +230,9 @@ void DeepFlavourTFJetTagsProducer::produce(edm::Event& iEvent, const edm::EventS
     input_tensors[input_sizes.size() + i] = tensorflow::NamedTensor(lp_names_[i], lp_tensors_[i]);
   }
 
+  // output tensors, reused for all batches (the session clears them on each run)
+  std::vector<tensorflow::Tensor> outputs;
+
   std::size_t n_batches = n_jets/n_batch_jets; // either 1 or n_jets
   for (std::size_t batch_n=0; batch_n < n_batches; batch_n++) {
 
@@ -280,8 +283,8 @@ void DeepFlavourTFJetTagsProducer::produce(edm::Event& iEvent, const edm::EventS
     }
 
     // run the session
-    std::vector<tensorflow::Tensor> outputs;
     tensorflow::run(session_, input_tensors, output_names_, &outputs);
+    const auto & flav_probs = outputs.at(kJetFlavour).matrix<float>();
 
     // set output values for flavour probs
     for (std::size_t jet_bn=0; jet_bn < (std::size_t) n_batch_jets; jet_bn++) {
@@ -294,7 +297,7 @@ void DeepFlavourTFJetTagsProducer::produce(edm::Event& iEvent, const edm::EventS
         const auto & flav_pair = flav_pairs_.at(flav_n);
         float o_sum = 0.;
         for (const unsigned int & ind : flav_pair.second) {
-          o_sum += outputs.at(kJetFlavour).matrix<float>()(jet_bn, ind);
+          o_sum += flav_probs(jet_bn, ind);
         }
         (*(output_tags.at(flav_n)))[jet_ref] = o_sum;
       }
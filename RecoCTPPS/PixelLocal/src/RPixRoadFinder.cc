@@ -51,10 +51,20 @@ void RPixRoadFinder::findPattern(){
 
 // convert local hit sto global and push them to a vector
   for(const auto & ds_rh2 : *hitVector_){
+    if (ds_rh2.data.empty()) continue;
     const auto myid = CTPPSPixelDetId(ds_rh2.id);
+
+    // the sensor is the same for all the hits of this plane
+    const DetGeomDesc* sensor = geometry_->getSensor(myid);
+    DetGeomDesc::RotationMatrix theRotationMatrix = sensor->rotation();
+    AlgebraicMatrix33 theRotationTMatrix;
+    theRotationMatrix.GetComponents(theRotationTMatrix(0, 0), theRotationTMatrix(0, 1), theRotationTMatrix(0, 2),
+                                    theRotationTMatrix(1, 0), theRotationTMatrix(1, 1), theRotationTMatrix(1, 2),
+                                    theRotationTMatrix(2, 0), theRotationTMatrix(2, 1), theRotationTMatrix(2, 2));
+
     for (const auto & it_rh : ds_rh2.data){
       CLHEP::Hep3Vector localV(it_rh.getPoint().x(),it_rh.getPoint().y(),it_rh.getPoint().z() );
-      CLHEP::Hep3Vector globalV = geometry_->localToGlobal(ds_rh2.id,localV);
+      CLHEP::Hep3Vector globalV = geometry_->localToGlobal(sensor,localV);
       math::Error<3>::type localError;
       localError[0][0] = it_rh.getError().xx();
       localError[0][1] = it_rh.getError().xy();
@@ -67,12 +77,6 @@ void RPixRoadFinder::findPattern(){
       localError[2][2] =                  0.;
       if(verbosity_>2) edm::LogInfo("RPixRoadFinder")<<"Hits = "<<ds_rh2.data.size();
 
-      DetGeomDesc::RotationMatrix theRotationMatrix = geometry_->getSensor(myid)->rotation();
-      AlgebraicMatrix33 theRotationTMatrix;
-      theRotationMatrix.GetComponents(theRotationTMatrix(0, 0), theRotationTMatrix(0, 1), theRotationTMatrix(0, 2),
-                                      theRotationTMatrix(1, 0), theRotationTMatrix(1, 1), theRotationTMatrix(1, 2),
-                                      theRotationTMatrix(2, 0), theRotationTMatrix(2, 1), theRotationTMatrix(2, 2));
-
       math::Error<3>::type globalError = ROOT::Math::SimilarityT(theRotationTMatrix, localError);
       PointInPlane thePointAndRecHit = {globalV,globalError,it_rh,myid};
       temp_all_hits.push_back(thePointAndRecHit);
@@ -28,11 +28,18 @@ public:
   void inline selectCallback(const GlobalPoint& p, const edm::SortedCollection<T>& inputCollection, std::function<void(const T&)> callback) {
     // TODO: handle default setting of detector_ (loops over subdet)
     // TODO: heuristics of when it is better to loop over inputCollection instead (small # hits)
+    // the same geometry object can serve several subdetectors (e.g. HCAL),
+    // so only redo the geometry search when the geometry object changes
+    const CaloSubdetectorGeometry* lastSdg=nullptr;
+    CaloSubdetectorGeometry::DetIdSet dis;
     for (int subdet=subdet_; subdet<=7 && (subdet_==0 || subdet_==subdet); subdet++) {
       const CaloSubdetectorGeometry* sdg=geom_->getSubdetectorGeometry(detector_,subdet);
       if (sdg!=nullptr) {
-        // get the list of detids within range (from geometry)
-        CaloSubdetectorGeometry::DetIdSet dis=sdg->getCells(p,deltaR_);
+        if (sdg!=lastSdg) {
+          // get the list of detids within range (from geometry)
+          dis=sdg->getCells(p,deltaR_);
+          lastSdg=sdg;
+        }
         // loop over detids...
         typename edm::SortedCollection<T>::const_iterator j, je = inputCollection.end(); 
   
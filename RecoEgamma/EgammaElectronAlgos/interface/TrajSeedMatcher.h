@@ -214,7 +214,8 @@ public:
 private:
   
   std::vector<SCHitMatch> processSeed(const TrajectorySeed& seed, const GlobalPoint& candPos,
-				   const GlobalPoint & vprim, const float energy, const int charge );
+				   const GlobalPoint & vprim, const float energy, const int charge,
+				   const TrajectoryStateOnSurface& initialTrajState);
 
   static float getZVtxFromExtrapolation(const GlobalPoint& primeVtxPos, const GlobalPoint& hitPos,
 					const GlobalPoint& candPos);
@@ -108,11 +108,21 @@ TrajSeedMatcher::compatibleSeeds(const TrajectorySeedCollection& seeds, const Gl
   }
 
   clearCache();
+
+  //the initial state only depends on the candidate and the charge, not on the seed
+  PerpendicularBoundPlaneBuilder bpb;
+  auto makeInitialTrajState = [&](const int charge){
+    FreeTrajectoryState trajStateFromVtx = FTSFromVertexToPointFactory::get(*magField_, candPos, vprim, energy, charge);
+    return TrajectoryStateOnSurface(trajStateFromVtx,*bpb(trajStateFromVtx.position(),
+							  trajStateFromVtx.momentum()));
+  };
+  const TrajectoryStateOnSurface initialTrajStateNeg = makeInitialTrajState(-1);
+  const TrajectoryStateOnSurface initialTrajStatePos = makeInitialTrajState(+1);
   
   std::vector<SeedWithInfo> matchedSeeds;
   for(const auto& seed : seeds) {
-    std::vector<SCHitMatch> matchedHitsNeg = processSeed(seed,candPos,vprim,energy,-1);
-    std::vector<SCHitMatch> matchedHitsPos = processSeed(seed,candPos,vprim,energy,+1);
+    std::vector<SCHitMatch> matchedHitsNeg = processSeed(seed,candPos,vprim,energy,-1,initialTrajStateNeg);
+    std::vector<SCHitMatch> matchedHitsPos = processSeed(seed,candPos,vprim,energy,+1,initialTrajStatePos);
     int nrValidLayersPos = 0;
     int nrValidLayersNeg = 0;
     if(matchedHitsNeg.size()>=2){
@@ -152,15 +162,11 @@ TrajSeedMatcher::compatibleSeeds(const TrajectorySeedCollection& seeds, const Gl
 //the function returns, it doesnt allow skipping hits
 std::vector<TrajSeedMatcher::SCHitMatch>
 TrajSeedMatcher::processSeed(const TrajectorySeed& seed, const GlobalPoint& candPos,
-			     const GlobalPoint & vprim, const float energy, const int charge )
+			     const GlobalPoint & vprim, const float energy, const int charge,
+			     const TrajectoryStateOnSurface& initialTrajState)
 {
   const float candEta = candPos.eta();
   const float candEt = energy*std::sin(candPos.theta());
-  
-  FreeTrajectoryState trajStateFromVtx = FTSFromVertexToPointFactory::get(*magField_, candPos, vprim, energy, charge);
-  PerpendicularBoundPlaneBuilder bpb;
-  TrajectoryStateOnSurface initialTrajState(trajStateFromVtx,*bpb(trajStateFromVtx.position(), 
-								  trajStateFromVtx.momentum()));
  
   std::vector<SCHitMatch> matchedHits;
   SCHitMatch firstHit = matchFirstHit(seed,initialTrajState,vprim,*backwardPropagator_);
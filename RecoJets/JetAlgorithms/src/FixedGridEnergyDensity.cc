@@ -33,15 +33,24 @@ float FixedGridEnergyDensity::fixedGridRho(std::vector<float>& etabins,std::vect
      float phidist = phibins[1]-phibins[0];
      float etahalfdist = (etabins[1]-etabins[0])/2.;
      float phihalfdist = (phibins[1]-phibins[0])/2.;
+     // read the kinematics of the candidates once, instead of once per grid cell
+     const unsigned int nCands = pfCandidates->size();
+     vector<double> candEta(nCands), candPhi(nCands), candPt(nCands);
+     for (unsigned int ic=0;ic<nCands;++ic) {
+       const PFCandidate & pf = (*pfCandidates)[ic];
+       candEta[ic] = pf.eta();
+       candPhi[ic] = pf.phi();
+       candPt[ic]  = pf.pt();
+     }
      vector<float> sumPFNallSMDQ;
      sumPFNallSMDQ.reserve(etabins.size()*phibins.size());
      for (unsigned int ieta=0;ieta<etabins.size();++ieta) {
        for (unsigned int iphi=0;iphi<phibins.size();++iphi) {
 	 float pfniso_ieta_iphi = 0;
-	 for(PFCandidateCollection::const_iterator pf_it = pfCandidates->begin(); pf_it != pfCandidates->end(); pf_it++) {
-	   if (fabs(etabins[ieta]-pf_it->eta())>etahalfdist) continue;
-	   if (fabs(reco::deltaPhi(phibins[iphi],pf_it->phi()))>phihalfdist) continue;
-	   pfniso_ieta_iphi+=pf_it->pt();
+	 for (unsigned int ic=0;ic<nCands;++ic) {
+	   if (fabs(etabins[ieta]-candEta[ic])>etahalfdist) continue;
+	   if (fabs(reco::deltaPhi(phibins[iphi],candPhi[ic]))>phihalfdist) continue;
+	   pfniso_ieta_iphi+=candPt[ic];
 	 }
 	 sumPFNallSMDQ.push_back(pfniso_ieta_iphi);
        }
@@ -19,6 +19,10 @@ class ECFAdder : public edm::stream::EDProducer<> {
     
     void produce(edm::Event & iEvent, const edm::EventSetup & iSetup) override;
     float getECF(unsigned index, const edm::Ptr<reco::Jet> & object) const;
+    // collect the constituents of a jet into FJparticles, descending into subjets if needed
+    void getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const;
+    // evaluate ECF routine index on the jet made of nParticles constituents
+    float getECF(unsigned index, const fastjet::PseudoJet & jet, size_t nParticles) const;
 
     static void fillDescriptions(edm::ConfigurationDescriptions & descriptions);
     
@@ -49,6 +49,8 @@ class NjettinessAdder : public edm::stream::EDProducer<> {
     
     void produce(edm::Event & iEvent, const edm::EventSetup & iSetup) override ;
     float getTau(unsigned num, const edm::Ptr<reco::Jet> & object) const;
+    // collect the constituents of a jet into FJparticles
+    void getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const;
     
  private:	
     edm::InputTag                          src_;
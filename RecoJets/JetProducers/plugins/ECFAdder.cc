@@ -67,38 +67,52 @@ void ECFAdder::produce(edm::Event & iEvent, const edm::EventSetup & iSetup) {
   edm::Handle<edm::View<reco::Jet> > jets;
   iEvent.getByToken(src_token_, jets);
   
-  unsigned i=0;
-  for ( std::vector<unsigned>::const_iterator n = Njets_.begin(); n != Njets_.end(); ++n )
-    {
-      // prepare room for output
-      std::vector<float> ecfN;
-      ecfN.reserve(jets->size());
-
-      for ( typename edm::View<reco::Jet>::const_iterator jetIt = jets->begin() ; jetIt != jets->end() ; ++jetIt ) {
-
-	edm::Ptr<reco::Jet> jetPtr = jets->ptrAt(jetIt - jets->begin());
-
-	
-	float t= -1.0;
-	if ( selectors_[n - Njets_.begin()] (*jetIt) )
-	  t = getECF( i, jetPtr );	
+  // prepare room for output
+  std::vector<std::vector<float> > ecfN(Njets_.size());
+  for ( auto & ecf : ecfN ) ecf.reserve(jets->size());
 
-	ecfN.push_back(t);
+  // the constituents of each jet are collected once and shared by all N
+  std::vector<fastjet::PseudoJet> FJparticles;
+  for ( typename edm::View<reco::Jet>::const_iterator jetIt = jets->begin() ; jetIt != jets->end() ; ++jetIt ) {
+
+    edm::Ptr<reco::Jet> jetPtr = jets->ptrAt(jetIt - jets->begin());
+
+    bool haveConstituents = false;
+    fastjet::PseudoJet fjJet;
+    for ( unsigned i = 0; i < Njets_.size(); ++i ) {
+      float t= -1.0;
+      if ( selectors_[i] (*jetIt) ) {
+	if ( !haveConstituents ) {
+	  FJparticles.clear();
+	  getConstituents( jetPtr, FJparticles );
+	  fjJet = join(FJparticles);
+	  haveConstituents = true;
+	}
+	t = getECF( i, fjJet, FJparticles.size() );
       }
+      ecfN[i].push_back(t);
+    }
+  }
 
-      auto outT = std::make_unique<edm::ValueMap<float>>();
-      edm::ValueMap<float>::Filler fillerT(*outT);
-      fillerT.insert(jets, ecfN.begin(), ecfN.end());
-      fillerT.fill();
+  for ( unsigned i = 0; i < Njets_.size(); ++i ) {
+    auto outT = std::make_unique<edm::ValueMap<float>>();
+    edm::ValueMap<float>::Filler fillerT(*outT);
+    fillerT.insert(jets, ecfN[i].begin(), ecfN[i].end());
+    fillerT.fill();
 
-      iEvent.put(std::move(outT),variables_[i]);
-      ++i;
-    }
+    iEvent.put(std::move(outT),variables_[i]);
+  }
 }
 
 float ECFAdder::getECF(unsigned index, const edm::Ptr<reco::Jet> & object) const
 {
   std::vector<fastjet::PseudoJet> FJparticles;
+  getConstituents(object, FJparticles);
+  return getECF(index, join(FJparticles), FJparticles.size());
+}
+
+void ECFAdder::getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const
+{
   for (unsigned k = 0; k < object->numberOfDaughters(); ++k)
     {
       const reco::CandidatePtr & dp = object->daughterPtr(k);
@@ -122,9 +136,13 @@ float ECFAdder::getECF(unsigned index, const edm::Ptr<reco::Jet> & object) const
       else
 	edm::LogWarning("MissingJetConstituent") << "Jet constituent required for ECF computation is missing!";
     }
-  if ( FJparticles.size() > Njets_[index] )
+}
+
+float ECFAdder::getECF(unsigned index, const fastjet::PseudoJet & jet, size_t nParticles) const
+{
+  if ( nParticles > Njets_[index] )
     {
-      return routine_[index]->result(join(FJparticles));
+      return routine_[index]->result(jet);
     }
   else
     {
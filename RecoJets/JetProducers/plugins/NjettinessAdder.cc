@@ -79,6 +79,14 @@ void NjettinessAdder::produce(edm::Event & iEvent, const edm::EventSetup & iSetu
   edm::Handle<edm::View<reco::Jet> > jets;
   iEvent.getByToken(src_token_, jets);
   
+  // collect the constituents of each jet once; they are shared by all N.
+  // The routine is still called in the same order (N outer, jets inner),
+  // which matters for the axes definitions that use random seeding.
+  std::vector<std::vector<fastjet::PseudoJet> > FJparticles(jets->size());
+  for ( size_t ijet = 0; ijet < jets->size(); ++ijet ) {
+    getConstituents( jets->ptrAt(ijet), FJparticles[ijet] );
+  }
+
   for ( std::vector<unsigned>::const_iterator n = Njets_.begin(); n != Njets_.end(); ++n )
     {
       std::ostringstream tauN_str;
@@ -88,11 +96,9 @@ void NjettinessAdder::produce(edm::Event & iEvent, const edm::EventSetup & iSetu
       std::vector<float> tauN;
       tauN.reserve(jets->size());
 
-      for ( typename edm::View<reco::Jet>::const_iterator jetIt = jets->begin() ; jetIt != jets->end() ; ++jetIt ) {
-
-	edm::Ptr<reco::Jet> jetPtr = jets->ptrAt(jetIt - jets->begin());
+      for ( const auto & particles : FJparticles ) {
 
-	float t=getTau( *n, jetPtr );
+	float t=routine_->getTau( *n, particles );
 
 	tauN.push_back(t);
       }
@@ -109,6 +115,12 @@ void NjettinessAdder::produce(edm::Event & iEvent, const edm::EventSetup & iSetu
 float NjettinessAdder::getTau(unsigned num, const edm::Ptr<reco::Jet> & object) const
 {
   std::vector<fastjet::PseudoJet> FJparticles;
+  getConstituents(object, FJparticles);
+  return routine_->getTau(num, FJparticles); 
+}
+
+void NjettinessAdder::getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const
+{
   for (unsigned k = 0; k < object->numberOfDaughters(); ++k)
     {
       const reco::CandidatePtr & dp = object->daughterPtr(k);
@@ -117,8 +129,6 @@ float NjettinessAdder::getTau(unsigned num, const edm::Ptr<reco::Jet> & object)
       else
 	edm::LogWarning("MissingJetConstituent") << "Jet constituent required for N-subjettiness computation is missing!";
     }
-
-  return routine_->getTau(num, FJparticles); 
 }
 
 
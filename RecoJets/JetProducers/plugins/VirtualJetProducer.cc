@@ -318,6 +318,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
       output( iEvent, iSetup );
       return;
     }
+    inputs_.reserve(inputsHandle->size());
     for (size_t i = 0; i < inputsHandle->size(); ++i) {
       inputs_.push_back(inputsHandle->ptrAt(i));
     }
@@ -332,6 +333,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(pfinputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < pfinputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*pfinputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*pfinputsHandleAsFwdPtr)[i].ptr() );
@@ -345,6 +347,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(packedinputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < packedinputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*packedinputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*packedinputsHandleAsFwdPtr)[i].ptr() );
@@ -358,6 +361,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(geninputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < geninputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*geninputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*geninputsHandleAsFwdPtr)[i].ptr() );
@@ -371,6 +375,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(packedgeninputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < packedgeninputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*packedgeninputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*packedgeninputsHandleAsFwdPtr)[i].ptr() );
@@ -450,13 +455,14 @@ void VirtualJetProducer::inputTowers( )
   for (; i != inEnd; ++i ) {
     auto const & input = **i;
     // std::cout << "CaloTowerVI jets " << input->pt() << " " << input->et() << ' '<< input->energy() << ' ' << (isAnomalousTower(input) ? " bad" : " ok") << std::endl; 
-    if (edm::isNotFinite(input.pt()))           continue;
+    const double pt = input.pt();
+    if (edm::isNotFinite(pt))           continue;
     if (input.et()    <inputEtMin_)  continue;
     if (input.energy()<inputEMin_)   continue;
     if (isAnomalousTower(*i))      continue;
     // Change by SRR : this is no longer an error nor warning, this can happen with PU mitigation algos.
     // Also switch to something more numerically safe. (VI: 10^-42GeV????)
-    if (input.pt() < 100 * std::numeric_limits<double>::epsilon() ) { 
+    if (pt < 100 * std::numeric_limits<double>::epsilon() ) { 
       continue;
     }
     if (makeCaloJet(jetTypeE)&&doPVCorrection_) {
@@ -343,7 +343,8 @@ private:
 
   // Number of channels in the tower that were not used in RecHit production (dead/off,...).
   // These channels are added to the other "bad" channels found in the recHit collection. 
-  typedef std::map<CaloTowerDetId, std::pair<short int,bool>> HcalDropChMap;
+  // Indexed by the dense index of the tower; the flag marks towers with inefficient Hcal.
+  typedef std::vector<std::pair<short int,bool>> HcalDropChMap;
   HcalDropChMap hcalDropChMap;
 
   // Number of bad Ecal channel in each tower
@@ -327,6 +327,7 @@ void CaloTowersCreationAlgo::setGeometry(const CaloTowerTopology* cttopo, const
   
   //initialize ecal bad channel map
   ecalBadChs.resize(theTowerTopology->sizeForDenseIndexing(),0);
+  hcalDropChMap.resize(theTowerTopology->sizeForDenseIndexing(),std::make_pair(0,false));
 }
 
 void CaloTowersCreationAlgo::begin() {
@@ -943,8 +944,7 @@ void CaloTowersCreationAlgo::convert(const CaloTowerDetId& id, const MetaTower&
     if(metaContains.empty()) return;
 
     if (missingHcalRescaleFactorForEcal > 0 && E_had == 0 && E_em > 0) {
-        auto match = hcalDropChMap.find(id);
-        if (match != hcalDropChMap.end() && match->second.second) {
+        if (hcalDropChMap[theTowerTopology->denseIndex(id)].second) {
             E_had = missingHcalRescaleFactorForEcal * E_em;
             E += E_had;
         }
@@ -1117,8 +1117,7 @@ void CaloTowersCreationAlgo::convert(const CaloTowerDetId& id, const MetaTower&
     unsigned int numProbEcalChan = mt.numProbEcalCells;
 
     // now add dead/off/... channels not used in RecHit reconstruction for HCAL 
-    HcalDropChMap::iterator dropChItr = hcalDropChMap.find(id);
-    if (dropChItr != hcalDropChMap.end()) numBadHcalChan += dropChItr->second.first;
+    numBadHcalChan += hcalDropChMap[theTowerTopology->denseIndex(id)].first;
     
 
     // for ECAL the number of all bad channels is obtained here -----------------------
@@ -1612,9 +1611,9 @@ int CaloTowersCreationAlgo::compactTime(float time) {
 void CaloTowersCreationAlgo::makeHcalDropChMap() {
 
   // This method fills the map of number of dead channels for the calotower,
-  // The key of the map is CaloTowerDetId.
+  // The map is indexed by the dense index of the CaloTowerDetId.
   // By definition these channels are not going to be in the RecHit collections.
-  hcalDropChMap.clear();
+  hcalDropChMap.assign(theTowerTopology->sizeForDenseIndexing(), std::make_pair(0,false));
   std::vector<DetId> allChanInStatusCont = theHcalChStatus->getAllChannels();
 
 #ifdef EDM_ML_DEBUG
@@ -1628,8 +1627,9 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
       DetId id = theHcalTopology->mergedDepthDetId(HcalDetId(*it));
       
       CaloTowerDetId twrId = theTowerConstituentsMap->towerOf(id);
+      if (twrId.null()) continue;
       
-      hcalDropChMap[twrId].first +=1;
+      hcalDropChMap[theTowerTopology->denseIndex(twrId)].first +=1;
       
       HcalDetId hid(*it);
 	  
@@ -1640,17 +1640,18 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
 	bool merge = theHcalTopology->mergedDepth29(hid);
 	if (merge) {
           CaloTowerDetId twrId29(twrId.ieta()+twrId.zside(), twrId.iphi());
-          hcalDropChMap[twrId29].first +=1;
+          hcalDropChMap[theTowerTopology->denseIndex(twrId29)].first +=1;
 	}
       }
     }
   }
   // now I know how many bad channels, but I also need to know if there's any good ones
   if (missingHcalRescaleFactorForEcal > 0) {
-      for (auto & pair : hcalDropChMap) {
-          if (pair.second.first == 0) continue; // unexpected, but just in case
+      for (unsigned int ind = 0; ind < hcalDropChMap.size(); ++ind) {
+          auto & dropCh = hcalDropChMap[ind];
+          if (dropCh.first == 0) continue;
           int ngood = 0, nbad = 0;
-          for (DetId id : theTowerConstituentsMap->constituentsOf(pair.first)) {
+          for (DetId id : theTowerConstituentsMap->constituentsOf(theTowerTopology->detIdFromDenseIndex(ind))) {
               if (id.det() != DetId::Hcal) continue;
               HcalDetId hid(id);
               if (hid.subdet() != HcalBarrel && hid.subdet() != HcalEndcap) continue;
@@ -1663,9 +1664,9 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
           }
           if (nbad > 0 && nbad >= ngood) {
               //uncomment for debug (may be useful to tune the criteria above)
-              //CaloTowerDetId id(pair.first);
+              //CaloTowerDetId id(theTowerTopology->detIdFromDenseIndex(ind));
               //std::cout << "CaloTower at ieta = " << id.ieta() << ", iphi " << id.iphi() << ": set Hcal as not efficient (ngood =" << ngood << ", nbad = " << nbad << ")" << std::endl;
-              pair.second.second = true;
+              dropCh.second = true;
           }
       }
   }
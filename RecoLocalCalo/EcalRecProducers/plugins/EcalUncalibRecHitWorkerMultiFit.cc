@@ -322,13 +322,6 @@ EcalUncalibRecHitWorkerMultiFit::run( const edm::Event & evt,
         double pedRMSVec[3]  = { aped->rms_x12,  aped->rms_x6,  aped->rms_x1 };
         double gainRatios[3] = { 1., aGain->gain12Over6(), aGain->gain6Over1()*aGain->gain12Over6()};
 
-        for (int i=0; i<EcalPulseShape::TEMPLATESAMPLES; ++i)
-            fullpulse(i+7) = aPulse->pdfval[i];
-    
-        for(int i=0; i<EcalPulseShape::TEMPLATESAMPLES;i++)
-        for(int j=0; j<EcalPulseShape::TEMPLATESAMPLES;j++)
-            fullpulsecov(i+7,j+7) = aPulseCov->covval[i][j];
-        
 	// compute the right bin of the pulse shape using time calibration constants
 	EcalTimeCalibConstantMap::const_iterator it = itime->find( detid );
 	EcalTimeCalibConstant itimeconst = 0;
@@ -368,7 +361,15 @@ EcalUncalibRecHitWorkerMultiFit::run( const edm::Event & evt,
             // do not propagate the default chi2 = -1 value to the calib rechit (mapped to 64), set it to 0 when saturation
             uncalibRecHit.setChi2(0);
         } else {
-            // multifit
+            // multifit: the pulse templates are only needed from here on
+            // (saturated channels above never use them)
+            for (int i=0; i<EcalPulseShape::TEMPLATESAMPLES; ++i)
+                fullpulse(i+7) = aPulse->pdfval[i];
+
+            for(int i=0; i<EcalPulseShape::TEMPLATESAMPLES;i++)
+            for(int j=0; j<EcalPulseShape::TEMPLATESAMPLES;j++)
+                fullpulsecov(i+7,j+7) = aPulseCov->covval[i][j];
+
             const SampleMatrixGainArray &noisecors = noisecor(barrel);
             
             result.push_back(multiFitMethod_.makeRecHit(*itdg, aped, aGain, noisecors, fullpulse, fullpulsecov, activeBX));
@@ -50,10 +50,10 @@ private:
 
   void organizeByLayer(const reco::HGCalMultiCluster::ClusterCollection &);
   void reset(){
+    // keep the capacity: the per-layer vectors are refilled every event
     for( auto& it: points)
       {
         it.clear();
-        std::vector<KDNode>().swap(it);
       }
     std::fill(zees.begin(), zees.end(), 0.);
     for(unsigned int i = 0; i < minpos.size(); i++)
@@ -61,6 +61,16 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
   std::vector<int> vused(es.size(),0);
   unsigned int used = 0;
 
+  // number of clusters not yet assigned to a multicluster on each layer:
+  // once a layer is exhausted there is no point in searching it again
+  std::vector<unsigned int> layerOf(es.size());
+  std::vector<unsigned int> unusedOnLayer(2*(maxlayer+1));
+  for (unsigned int j = 0; j <= 2*maxlayer+1; ++j) {
+    unusedOnLayer[j] = points[j].size();
+    for (auto const & p : points[j]) layerOf[p.data.ind] = j;
+  }
+  std::vector<KDNode> found;
+
   unsigned int es_size = es.size();
   for(unsigned int i = 0; i < es_size; ++i) {
     if(vused[i]==0) {
@@ -68,6 +78,7 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
       temp.push_back(thecls[es[i]]);
       vused[i]=(thecls[es[i]]->z()>0)? 1 : -1;
       ++used;
+      --unusedOnLayer[layerOf[i]];
       // Starting from cluster es[i] at from[0] - from[1] - from[2]
       std::array<double,3> from{ {thecls[es[i]]->x(),thecls[es[i]]->y(),thecls[es[i]]->z()} };
       unsigned int firstlayer = int(thecls[es[i]]->z()>0)*(maxlayer+1);
@@ -77,6 +88,7 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
 	  // layer j not yet ever reached?
 	  continue;
 	}
+	if(unusedOnLayer[j]==0) continue;
 	std::array<double,3> to{ {0.,0.,zees[j]} };
 	layerIntersection(to,from);
         unsigned int layer = j > maxlayer ? (j-(maxlayer+1)) : j; //maps back from index used for KD trees to actual layer
@@ -88,7 +100,7 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
         float radius2 = radius*radius;
 	KDTreeBox search_box(float(to[0])-radius,float(to[0])+radius,
 			     float(to[1])-radius,float(to[1])+radius);
-	std::vector<KDNode> found;
+	found.clear();
 	// at layer j in box float(to[0])+/-radius - float(to[1])+/-radius
 	hit_kdtree[j].search(search_box,found);
 	// found found.size() clusters within box
@@ -97,6 +109,7 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
 	    temp.push_back(thecls[es[found[k].data.ind]]);
 	    vused[found[k].data.ind]=vused[i];
 	    ++used;
+	    --unusedOnLayer[j];
 	  }
 	}
 
@@ -269,11 +269,12 @@ double HGCalImagingAlgo::calculateLocalDensity(std::vector<KDNode> &nd,
     delta_c = vecDeltas_[2];
 
   // for each node calculate local density rho and store it
+  std::vector<KDNode> found;
   for (unsigned int i = 0; i < nd.size(); ++i) {
     // speec up search by looking within +/- delta_c window only
     KDTreeBox search_box(nd[i].dims[0] - delta_c, nd[i].dims[0] + delta_c,
                          nd[i].dims[1] - delta_c, nd[i].dims[1] + delta_c);
-    std::vector<KDNode> found;
+    found.clear();
     lp.search(search_box, found);
     const unsigned int found_size = found.size();
     for (unsigned int j = 0; j < found_size; j++) {
@@ -315,21 +316,33 @@ HGCalImagingAlgo::calculateDistanceToHigher(std::vector<KDNode> &nd) const {
   const double max_dist2 = dist2;
   const unsigned int nd_size = nd.size();
 
+  // copy the positions in decreasing density order into contiguous arrays,
+  // so that the quadratic loop below streams through memory instead of
+  // jumping between KDNodes
+  std::vector<double> xs(nd_size), ys(nd_size);
+  for (unsigned int oi = 0; oi < nd_size; ++oi) {
+    xs[oi] = nd[rs[oi]].data.x;
+    ys[oi] = nd[rs[oi]].data.y;
+  }
+
   for (unsigned int oi = 1; oi < nd_size;
        ++oi) { // start from second-highest density
     dist2 = max_dist2;
     unsigned int i = rs[oi];
+    const double xi = xs[oi];
+    const double yi = ys[oi];
     // we only need to check up to oi since hits
     // are ordered by decreasing density
     // and all points coming BEFORE oi are guaranteed to have higher rho
     // and the ones AFTER to have lower rho
     for (unsigned int oj = 0; oj < oi; ++oj) {
-      unsigned int j = rs[oj];
-      double tmp = distance2(nd[i].data, nd[j].data);
+      const double dx = xi - xs[oj];
+      const double dy = yi - ys[oj];
+      double tmp = dx * dx + dy * dy;
       if (tmp <= dist2) { // this "<=" instead of "<" addresses the (rare) case
                           // when there are only two hits
         dist2 = tmp;
-        nearestHigher = j;
+        nearestHigher = rs[oj];
       }
     }
     nd[i].data.delta = std::sqrt(dist2);
@@ -417,13 +430,14 @@ int HGCalImagingAlgo::findAndAssignClusters(
   lp.build(nd, bounds);
   // now loop on all hits again :( and check: if there are hits from another
   // cluster within d_c -> flag as border hit
+  std::vector<KDNode> found;
   for (unsigned int i = 0; i < nd_size; ++i) {
     int ci = nd[i].data.clusterIndex;
     bool flag_isolated = true;
     if (ci != -1) {
       KDTreeBox search_box(nd[i].dims[0] - delta_c, nd[i].dims[0] + delta_c,
                            nd[i].dims[1] - delta_c, nd[i].dims[1] + delta_c);
-      std::vector<KDNode> found;
+      found.clear();
       lp.search(search_box, found);
 
       const unsigned int found_size = found.size();
@@ -205,5 +205,20 @@ class MahiFit
   std::unique_ptr<FitterFuncs::PulseShapeFunctor> psfPtr_;
   std::unique_ptr<ROOT::Math::Functor> pfunctor_;
 
+  //pulse shapes evaluated at t0 and t0 -/+ dt for the last few arrival time
+  //hypotheses; the same t0 recurs for most BXs and channels (always, without
+  //time slew), and the functor evaluation dominates updatePulseShape
+  struct PulseShapeCacheEntry {
+    float t0;
+    double dt;
+    std::array<double, MaxSVSize> pulseN;
+    std::array<double, MaxSVSize> pulseM;
+    std::array<double, MaxSVSize> pulseP;
+  };
+  static constexpr unsigned int pulseShapeCacheSize_ = 4;
+  mutable std::array<PulseShapeCacheEntry, pulseShapeCacheSize_> pulseShapeCache_;
+  mutable unsigned int pulseShapeCacheFilled_ = 0;
+  mutable unsigned int pulseShapeCacheNext_ = 0;
+
 }; 
 #endif
@@ -254,22 +254,46 @@ void MahiFit::updatePulseShape(double itQ, FullSampleVector &pulseShape, FullSam
     else t0+=hcalTimeSlewDelay_->delay(itQ,slewFlavor_);
   }
 
-  nnlsWork_.pulseN.fill(0);
-  nnlsWork_.pulseM.fill(0);
-  nnlsWork_.pulseP.fill(0);
+  const PulseShapeCacheEntry* cached = nullptr;
+  for (unsigned int i=0; i<pulseShapeCacheFilled_; ++i) {
+    if (pulseShapeCache_[i].t0==t0 && pulseShapeCache_[i].dt==nnlsWork_.dt) {
+      cached = &pulseShapeCache_[i];
+      break;
+    }
+  }
+
+  if (cached) {
+    nnlsWork_.pulseN = cached->pulseN;
+    nnlsWork_.pulseM = cached->pulseM;
+    nnlsWork_.pulseP = cached->pulseP;
+  }
+  else {
+    nnlsWork_.pulseN.fill(0);
+    nnlsWork_.pulseM.fill(0);
+    nnlsWork_.pulseP.fill(0);
 
-  const double xx[4]={t0, 1.0, 0.0, 3};
-  const double xxm[4]={-nnlsWork_.dt+t0, 1.0, 0.0, 3};
-  const double xxp[4]={ nnlsWork_.dt+t0, 1.0, 0.0, 3};
+    const double xx[4]={t0, 1.0, 0.0, 3};
+    const double xxm[4]={-nnlsWork_.dt+t0, 1.0, 0.0, 3};
+    const double xxp[4]={ nnlsWork_.dt+t0, 1.0, 0.0, 3};
 
-  (*pfunctor_)(&xx[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseN);
+    (*pfunctor_)(&xx[0]);
+    psfPtr_->getPulseShape(nnlsWork_.pulseN);
 
-  (*pfunctor_)(&xxm[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseM);
+    (*pfunctor_)(&xxm[0]);
+    psfPtr_->getPulseShape(nnlsWork_.pulseM);
   
-  (*pfunctor_)(&xxp[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseP);
+    (*pfunctor_)(&xxp[0]);
+    psfPtr_->getPulseShape(nnlsWork_.pulseP);
+
+    auto& entry = pulseShapeCache_[pulseShapeCacheNext_];
+    entry.t0 = t0;
+    entry.dt = nnlsWork_.dt;
+    entry.pulseN = nnlsWork_.pulseN;
+    entry.pulseM = nnlsWork_.pulseM;
+    entry.pulseP = nnlsWork_.pulseP;
+    pulseShapeCacheNext_ = (pulseShapeCacheNext_+1)%pulseShapeCacheSize_;
+    pulseShapeCacheFilled_ = std::min(pulseShapeCacheFilled_+1, pulseShapeCacheSize_);
+  }
 
   //in the 2018+ case where the sample of interest (SOI) is in TS3, add an extra offset to align 
   //with previous SOI=TS4 case assumed by psfPtr_->getPulseShape()
@@ -480,6 +504,10 @@ void MahiFit::resetPulseShapeTemplate(const HcalPulseShapes::Shape& ps) {
 						   1,0,0,10));
   pfunctor_ = std::unique_ptr<ROOT::Math::Functor>( new ROOT::Math::Functor(psfPtr_.get(),&FitterFuncs::PulseShapeFunctor::singlePulseShapeFunc, 3) );
 
+  // the cached pulse shapes belong to the previous template
+  pulseShapeCacheFilled_ = 0;
+  pulseShapeCacheNext_ = 0;
+
 
 }
 
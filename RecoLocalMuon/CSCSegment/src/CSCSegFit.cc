@@ -171,11 +171,12 @@ void CSCSegFit::fitlsq(void) {
     // Covariance matrix of local errors 
     SMatrixSym2 IC; // 2x2, init to 0
     
-    IC(0,0) = hit.localPositionError().xx();
-    IC(1,1) = hit.localPositionError().yy();
+    const LocalError hitErr = hit.localPositionError();
+    IC(0,0) = hitErr.xx();
+    IC(1,1) = hitErr.yy();
     //@@ NOT SURE WHICH OFF-DIAGONAL ELEMENT MUST BE DEFINED BUT (1,0) WORKS
     //@@ (and SMatrix enforces symmetry)
-    IC(1,0) = hit.localPositionError().xy();
+    IC(1,0) = hitErr.xy();
     // IC(0,1) = IC(1,0);
     
     // Invert covariance matrix (and trap if it fails!)
@@ -266,10 +267,11 @@ void CSCSegFit::setChi2(void) {
 
     SMatrixSym2 IC; // 2x2, init to 0
 
-    IC(0,0) = hit.localPositionError().xx();
-    //    IC(0,1) = hit.localPositionError().xy();
-    IC(1,0) = hit.localPositionError().xy();
-    IC(1,1) = hit.localPositionError().yy();
+    const LocalError hitErr = hit.localPositionError();
+    IC(0,0) = hitErr.xx();
+    //    IC(0,1) = hitErr.xy();
+    IC(1,0) = hitErr.xy();
+    IC(1,1) = hitErr.yy();
     //    IC(1,0) = IC(0,1);
 
     //    LogTrace("CSCSegFit") << "[CSCSegFit::setChi2] IC before = \n" << IC;
@@ -309,11 +311,12 @@ CSCSegFit::SMatrixSym12 CSCSegFit::weightMatrix() {
 
 // Note scaleXError allows rescaling the x error if necessary
 
-    matrix(row, row)   = scaleXError()*hit.localPositionError().xx();
-    matrix(row, row+1) = hit.localPositionError().xy();
+    const LocalError hitErr = hit.localPositionError();
+    matrix(row, row)   = scaleXError()*hitErr.xx();
+    matrix(row, row+1) = hitErr.xy();
     ++row;
-    matrix(row, row-1) = hit.localPositionError().xy();
-    matrix(row, row)   = hit.localPositionError().yy();
+    matrix(row, row-1) = hitErr.xy();
+    matrix(row, row)   = hitErr.yy();
     ++row;
   }
 
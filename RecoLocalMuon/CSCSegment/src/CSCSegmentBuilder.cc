@@ -18,6 +18,8 @@
 #include <FWCore/Utilities/interface/Exception.h>
 #include <FWCore/MessageLogger/interface/MessageLogger.h> 
 
+#include <algorithm>
+
 CSCSegmentBuilder::CSCSegmentBuilder(const edm::ParameterSet& ps) : geom_(nullptr) {
     
     // The algo chosen for the segment building
@@ -68,16 +70,10 @@ void CSCSegmentBuilder::build(const CSCRecHit2DCollection* recHits, CSCSegmentCo
     
     for(CSCRecHit2DCollection::const_iterator it2 = recHits->begin(); it2 != recHits->end(); it2++) {
         
-        bool insert = true;
-        for(chIt=chambers.begin(); chIt != chambers.end(); ++chIt) 
-            if (((*it2).cscDetId().chamber() == (*chIt).chamber()) &&
-                ((*it2).cscDetId().station() == (*chIt).station()) &&
-                ((*it2).cscDetId().ring() == (*chIt).ring()) &&
-                ((*it2).cscDetId().endcap() == (*chIt).endcap()))
-                insert = false;
-	
-        if (insert)
-            chambers.push_back((*it2).cscDetId().chamberId());
+        // hits are grouped by chamber, so search from the most recently added one
+        CSCDetId chamberId = (*it2).cscDetId().chamberId();
+        if (std::find(chambers.rbegin(), chambers.rend(), chamberId) == chambers.rend())
+            chambers.push_back(chamberId);
     }
 
     for(chIt=chambers.begin(); chIt != chambers.end(); ++chIt) {
@@ -87,6 +83,7 @@ void CSCSegmentBuilder::build(const CSCRecHit2DCollection* recHits, CSCSegmentCo
         
         CSCRangeMapAccessor acc;
         CSCRecHit2DCollection::range range = recHits->get(acc.cscChamber(*chIt));
+        cscRecHits.reserve(range.second - range.first);
         
         std::vector<int> hitPerLayer(6);
         for(CSCRecHit2DCollection::const_iterator rechit = range.first; rechit != range.second; rechit++) {
@@ -117,7 +117,6 @@ void SiPixelClusterProducer::fillDescriptions(edm::ConfigurationDescriptions& de
 
     // Step B: create the final output collection
     auto output = std::make_unique< SiPixelClusterCollectionNew>();
-    //FIXME: put a reserve() here
 
     // Step C: Iterate over DetIds and invoke the pixel clusterizer algorithm
     // on each DetUnit
@@ -161,6 +160,15 @@ void SiPixelClusterProducer::fillDescriptions(edm::ConfigurationDescriptions& de
                                    edmNew::DetSetVector<SiPixelCluster> & output) {
     int numberOfDetUnits = 0;
     int numberOfClusters = 0;
+
+    // Pre-size the output: there is at most one DetSet per input DetSet, and the
+    // number of input digis bounds the number of clusters, so the FastFillers
+    // below do not reallocate while filling.  When reclustering, one input cluster
+    // can be split into several, so the input cluster count is only a size hint.
+    // produce() shrinks the collection afterwards.
+    size_t nInputObjects = 0;
+    for (auto const & ds : input) nInputObjects += ds.size();
+    output.reserve(input.size(), nInputObjects);
  
     // Iterate on detector units
     typename T::const_iterator DSViter = input.begin();
@@ -43,6 +43,7 @@ class StripClusterizerAlgorithm {
     std::vector<uint8_t> ADCs;  
     uint16_t lastStrip=0;
     float noiseSquared=0;
+    int adcSum=0; // of the ADCs before gain correction
     bool candidateLacksSeed=true;
   private:
     Det const & m_det;
@@ -58,7 +58,7 @@ class ThreeThresholdAlgorithm final : public StripClusterizerAlgorithm {
 
   //state modification methods
     template<class T> void endCandidate(State & state, T&) const;
-    void clearCandidate(State & state) const { state.candidateLacksSeed = true;  state.noiseSquared = 0;  state.ADCs.clear();}
+    void clearCandidate(State & state) const { state.candidateLacksSeed = true;  state.noiseSquared = 0;  state.adcSum = 0;  state.ADCs.clear();}
     void addToCandidate(State & state, const SiStripDigi& digi) const { addToCandidate(state, digi.strip(),digi.adc());}
     void addToCandidate(State & state, uint16_t strip, uint8_t adc) const;
     void appendBadNeighbors(State & state) const;
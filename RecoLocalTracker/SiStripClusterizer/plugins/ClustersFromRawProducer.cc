@@ -420,14 +420,14 @@ try { // edmNew::CapacityExaustedException
     if (!buffer) { 
       buffer = fillBuffer(fedId, rawColl).release();
       if (!buffer) { continue;}
+      // set before publishing, so other threads never write to a shared buffer
+      buffer->setLegacyMode(legacy_);
       sistrip::FEDBuffer * exp = nullptr;
       if (done[fedId].compare_exchange_strong(exp, buffer)) buffers[fedId].reset(buffer);
       else { delete buffer; buffer = done[fedId]; }
     }
     assert(buffer);
 
-    buffer->setLegacyMode(legacy_);
-
     // check channel
     const uint8_t fedCh = conn->fedCh();
     
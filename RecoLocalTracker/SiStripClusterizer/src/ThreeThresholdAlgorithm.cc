@@ -2,7 +2,6 @@
 #include "DataFormats/SiStripDigi/interface/SiStripDigi.h"
 #include "DataFormats/SiStripCluster/interface/SiStripCluster.h"
 #include <cmath>
-#include <numeric>
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 
 #include "DataFormats/SiStripCluster/interface/SiStripClusterTools.h"
@@ -73,6 +72,7 @@ addToCandidate(State & state, uint16_t strip, uint8_t adc) const {
 
   state.ADCs.push_back( adc );
   state.noiseSquared += Noise*Noise;
+  state.adcSum += adc;
 }
 
 template <class T>
@@ -91,9 +91,10 @@ endCandidate(State & state, T& out) const {
 inline 
 bool ThreeThresholdAlgorithm::
 candidateAccepted(State const & state) const {
+  float charge = state.adcSum;
   return ( !state.candidateLacksSeed &&
 	   state.noiseSquared * ClusterThresholdSquared
-	   <=  std::pow( float(std::accumulate(state.ADCs.begin(),state.ADCs.end(), int(0))), 2.f));
+	   <=  charge*charge);
 }
 
 inline
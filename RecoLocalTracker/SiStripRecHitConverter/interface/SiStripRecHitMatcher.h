@@ -182,6 +182,7 @@ void SiStripRecHitMatcher::doubleMatch(MonoIterator monoRHiter, MonoIterator mon
   ToGlobal const & stripDetTrans =  stripdet->surface();
   ToGlobal const & partnerStripDetTrans = partnerstripdet->surface();
   ToLocal          gluedDetInvTrans(gluedDet->surface());
+  auto const &     gluedBounds = gluedDet->surface().bounds();
   
   
   
@@ -315,7 +316,7 @@ void SiStripRecHitMatcher::doubleMatch(MonoIterator monoRHiter, MonoIterator mon
       Local2DPoint position(resultmatmul[0], resultmatmul[1]);
       
       // LocalError tempError (100,0,100);
-      if (!((gluedDet->surface()).bounds().inside(position,10.f*scale_))) continue;                                                       
+      if (!gluedBounds.inside(position,10.f*scale_)) continue;
       
       double c2 = -si.m10;
       double s2 = -si.m11;
@@ -334,7 +335,7 @@ void SiStripRecHitMatcher::doubleMatch(MonoIterator monoRHiter, MonoIterator mon
       LocalError error(result[0], result[1], result[2]);
       
       
-      if((gluedDet->surface()).bounds().inside(position,error,scale_)){ //if it is inside the gluedet bonds
+      if(gluedBounds.inside(position,error,scale_)){ //if it is inside the gluedet bonds
 	
 	//Change NSigmaInside in the configuration file to accept more hits
 	//...and add it to the Rechit collection 
@@ -214,16 +214,16 @@ namespace {
 
     // std::cout << " => collectedStrips: " << collectedStrips.size() << std::endl;
     if(!stripClusters_.isUninitialized()){ 
-    	auto removedStripClusterMask =
-      		std::make_unique<StripMaskContainer>(edm::RefProd<edmNew::DetSetVector<SiStripCluster>>(stripClusters),collectedStrips);
       LogDebug("TrackClusterRemover")<<"total strip to skip: "<<std::count(collectedStrips.begin(),collectedStrips.end(),true);
+    	auto removedStripClusterMask =
+      		std::make_unique<StripMaskContainer>(edm::RefProd<edmNew::DetSetVector<SiStripCluster>>(stripClusters),std::move(collectedStrips));
       // std::cout << "TrackClusterRemover " <<"total strip to skip: "<<std::count(collectedStrips.begin(),collectedStrips.end(),true) <<std::endl;
       iEvent.put(std::move(removedStripClusterMask));
     }
     if(!pixelClusters_.isUninitialized()){
-      auto removedPixelClusterMask= 
-	std::make_unique<PixelMaskContainer>(edm::RefProd<edmNew::DetSetVector<SiPixelCluster>>(pixelClusters),collectedPixels);      
       LogDebug("TrackClusterRemover")<<"total pxl to skip: "<<std::count(collectedPixels.begin(),collectedPixels.end(),true);
+      auto removedPixelClusterMask= 
+	std::make_unique<PixelMaskContainer>(edm::RefProd<edmNew::DetSetVector<SiPixelCluster>>(pixelClusters),std::move(collectedPixels));      
       iEvent.put(std::move(removedPixelClusterMask));
     }
 
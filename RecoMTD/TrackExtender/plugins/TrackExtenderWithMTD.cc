@@ -398,10 +398,10 @@ TrackExtenderWithMTDT<TrackCollection>::tryBTLLayers(const TrackType& track,
   TransientTrackingRecHit::ConstRecHitContainer output;
   const vector<const DetLayer*>& layers = geo->allBTLLayers();
   auto tTrack = builder->build(track);
+  // get the outermost trajectory point on the track
+  const TrajectoryStateOnSurface tsos = tTrack.outermostMeasurementState();
 
   for (const DetLayer* ilay : layers) {
-    // get the outermost trajectory point on the track    
-    TrajectoryStateOnSurface tsos = tTrack.outermostMeasurementState();
     find_hits_in_dets(hits,ilay,tsos,prop,*theEstimator,*hitbuilder,output);
   }
   return output;
@@ -419,13 +419,13 @@ TrackExtenderWithMTDT<TrackCollection>::tryETLLayers(const TrackType& track,
   const vector<const DetLayer*>& layers = geo->allETLLayers();
 
   auto tTrack = builder->build(track);
+  // get the outermost trajectory point on the track
+  const TrajectoryStateOnSurface tsos = tTrack.outermostMeasurementState();
   
   for (const DetLayer* ilay : layers) {
     const BoundDisk& disk = static_cast<const MTDRingForwardDoubleLayer*>(ilay)->specificSurface();
     const double diskZ = disk.position().z();
 
-    // get the outermost trajectory point on the track    
-    TrajectoryStateOnSurface tsos = tTrack.outermostMeasurementState();
     if( tsos.globalPosition().z() * diskZ < 0 ) continue; // only propagate to the disk that's on the same side
     find_hits_in_dets(hits,ilay,tsos,prop,*theEstimator,*hitbuilder,output);    
   }
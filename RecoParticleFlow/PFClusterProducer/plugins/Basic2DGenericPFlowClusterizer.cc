@@ -93,12 +93,14 @@ buildClusters(const reco::PFClusterCollection& input,
 	      const std::vector<bool>& seedable,
 	      reco::PFClusterCollection& output) {
   reco::PFClusterCollection clustersInTopo;
+  std::vector<double> recHitEnergyNorms;
   for( const auto& topocluster : input ) {
     clustersInTopo.clear();
     seedPFClustersFromTopo(topocluster,seedable,clustersInTopo);
     const unsigned tolScal = 
       std::pow(std::max(1.0,clustersInTopo.size()-1.0),2.0);
-    growPFClusters(topocluster,seedable,tolScal,0,tolScal,clustersInTopo);
+    fillRecHitEnergyNorms(topocluster,recHitEnergyNorms);
+    growPFClusters(topocluster,seedable,recHitEnergyNorms,tolScal,0,tolScal,clustersInTopo);
     // step added by Josh Bendavid, removes low-fraction clusters
     // did not impact position resolution with fraction cut of 1e-7
     // decreases the size of each pf cluster considerably
@@ -139,9 +141,38 @@ seedPFClustersFromTopo(const reco::PFCluster& topo,
   }
 }
 
+void Basic2DGenericPFlowClusterizer::
+fillRecHitEnergyNorms(const reco::PFCluster& topo,
+		      std::vector<double>& recHitEnergyNorms) const {
+  recHitEnergyNorms.clear();
+  recHitEnergyNorms.reserve(topo.recHitFractions().size());
+  for( const reco::PFRecHitFraction& rhf : topo.recHitFractions() ) {
+    const reco::PFRecHitRef& refhit = rhf.recHitRef();
+    int cell_layer = (int)refhit->layer();
+    if( cell_layer == PFLayer::HCAL_BARREL2 && 
+	std::abs(refhit->positionREP().eta()) > 0.34 ) {
+      cell_layer *= 100;
+    }  
+
+    double recHitEnergyNorm=0.;
+    auto const& recHitEnergyNormDepthPair = _recHitEnergyNorms.find(cell_layer)->second;
+
+    for (unsigned int j=0; j<recHitEnergyNormDepthPair.second.size(); ++j) {
+      int depth=recHitEnergyNormDepthPair.first[j];
+
+      if( ( cell_layer == PFLayer::HCAL_BARREL1 && refhit->depth()== depth)
+	  || ( cell_layer == PFLayer::HCAL_ENDCAP && refhit->depth()== depth)
+	  || ( cell_layer != PFLayer::HCAL_ENDCAP && cell_layer != PFLayer::HCAL_BARREL1)
+	  ) recHitEnergyNorm = recHitEnergyNormDepthPair.second[j];
+    }
+    recHitEnergyNorms.push_back(recHitEnergyNorm);
+  }
+}
+
 void Basic2DGenericPFlowClusterizer::
 growPFClusters(const reco::PFCluster& topo,
 	       const std::vector<bool>& seedable,
+	       const std::vector<double>& recHitEnergyNorms,
 	       const unsigned toleranceScaling,
 	       const unsigned iter,
 	       double diff,
@@ -155,6 +186,7 @@ growPFClusters(const reco::PFCluster& topo,
       diff <= _stoppingTolerance*toleranceScaling) return;
   // reset the rechits in this cluster, keeping the previous position    
   std::vector<reco::PFCluster::REPPoint> clus_prev_pos;  
+  clus_prev_pos.reserve(clusters.size());
   for( auto& cluster : clusters) {
     const reco::PFCluster::REPPoint& repp = cluster.positionREP();
     clus_prev_pos.emplace_back(repp.rho(),repp.eta(),repp.phi());
@@ -169,29 +201,16 @@ growPFClusters(const reco::PFCluster& topo,
   }
   // loop over topo cluster and grow current PFCluster hypothesis 
   std::vector<double> dist2, frac;
+  dist2.reserve(clusters.size()); frac.reserve(clusters.size());
   double fractot = 0;
-  for( const reco::PFRecHitFraction& rhf : topo.recHitFractions() ) {
-    const reco::PFRecHitRef& refhit = rhf.recHitRef();
-    int cell_layer = (int)refhit->layer();
-    if( cell_layer == PFLayer::HCAL_BARREL2 && 
-	std::abs(refhit->positionREP().eta()) > 0.34 ) {
-      cell_layer *= 100;
-    }  
+  const auto& recHitFractions = topo.recHitFractions();
+  for( unsigned irhf = 0; irhf < recHitFractions.size(); ++irhf ) {
+    const reco::PFRecHitRef& refhit = recHitFractions[irhf].recHitRef();
 
     math::XYZPoint topocellpos_xyz(refhit->position());
     dist2.clear(); frac.clear(); fractot = 0;
 
-    double recHitEnergyNorm=0.;
-    auto const& recHitEnergyNormDepthPair = _recHitEnergyNorms.find(cell_layer)->second;
-
-    for (unsigned int j=0; j<recHitEnergyNormDepthPair.second.size(); ++j) {
-      int depth=recHitEnergyNormDepthPair.first[j];
-
-      if( ( cell_layer == PFLayer::HCAL_BARREL1 && refhit->depth()== depth)
-	  || ( cell_layer == PFLayer::HCAL_ENDCAP && refhit->depth()== depth)
-	  || ( cell_layer != PFLayer::HCAL_ENDCAP && cell_layer != PFLayer::HCAL_BARREL1)
-	  ) recHitEnergyNorm = recHitEnergyNormDepthPair.second[j];
-    }
+    const double recHitEnergyNorm = recHitEnergyNorms[irhf];
 
     // add rechits to clusters, calculating fraction based on distance
     for( auto& cluster : clusters ) {      
@@ -258,7 +277,7 @@ growPFClusters(const reco::PFCluster& topo,
   }
   diff = std::sqrt(diff2);
   dist2.clear(); frac.clear(); clus_prev_pos.clear();// avoid badness
-  growPFClusters(topo,seedable,toleranceScaling,iter+1,diff,clusters);
+  growPFClusters(topo,seedable,recHitEnergyNorms,toleranceScaling,iter+1,diff,clusters);
 }
 
 void Basic2DGenericPFlowClusterizer::
@@ -41,8 +41,14 @@ class Basic2DGenericPFlowClusterizer : public PFClusterBuilderBase {
 			      const std::vector<bool>&,
 			      reco::PFClusterCollection&) const;
 
+  // energy normalisation of each rechit of the topo cluster, in the order
+  // of its recHitFractions(); it does not change between iterations
+  void fillRecHitEnergyNorms(const reco::PFCluster&,
+			     std::vector<double>&) const;
+
   void growPFClusters(const reco::PFCluster&,
 		      const std::vector<bool>&,
+		      const std::vector<double>& recHitEnergyNorms,
 		      const unsigned toleranceScaling,
 		      const unsigned iter,
 		      double dist,
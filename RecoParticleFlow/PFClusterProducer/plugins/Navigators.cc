@@ -9,6 +9,22 @@
 #include "RecoParticleFlow/PFClusterProducer/interface/PFECALHashNavigator.h"
 #include "RecoParticleFlow/PFClusterProducer/interface/HGCRecHitNavigator.h"
 
+namespace {
+  // The ECAL topologies only depend on the calorimeter geometry: rebuild them
+  // when the geometry IOV changes instead of allocating new ones every event.
+  template<typename TOPO>
+  void updateEcalTopology(const edm::EventSetup& iSetup,
+                          std::unique_ptr<const TOPO>& topology,
+                          unsigned long long& geometryCacheId) {
+    const CaloGeometryRecord& record = iSetup.get<CaloGeometryRecord>();
+    if( topology && record.cacheIdentifier() == geometryCacheId ) return;
+    geometryCacheId = record.cacheIdentifier();
+    edm::ESHandle<CaloGeometry> geoHandle;
+    record.get(geoHandle);
+    topology.reset( new TOPO(geoHandle) );
+  }
+}
+
 class PFRecHitEcalBarrelNavigatorWithTime : public PFRecHitCaloNavigatorWithTime<EBDetId,EcalBarrelTopology> {
  public:
   PFRecHitEcalBarrelNavigatorWithTime(const edm::ParameterSet& iConfig):
@@ -18,10 +34,11 @@ class PFRecHitEcalBarrelNavigatorWithTime : public PFRecHitCaloNavigatorWithTime
     }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
-    edm::ESHandle<CaloGeometry> geoHandle;
-    iSetup.get<CaloGeometryRecord>().get(geoHandle);
-    topology_.reset( new EcalBarrelTopology(geoHandle) );
+    updateEcalTopology(iSetup, topology_, geometryCacheId_);
   }
+
+ private:
+  unsigned long long geometryCacheId_ = 0;
 };
 
 class PFRecHitEcalEndcapNavigatorWithTime : public PFRecHitCaloNavigatorWithTime<EEDetId,EcalEndcapTopology> {
@@ -33,10 +50,11 @@ class PFRecHitEcalEndcapNavigatorWithTime : public PFRecHitCaloNavigatorWithTime
     }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
-    edm::ESHandle<CaloGeometry> geoHandle;
-    iSetup.get<CaloGeometryRecord>().get(geoHandle);
-    topology_.reset( new EcalEndcapTopology(geoHandle) );
+    updateEcalTopology(iSetup, topology_, geometryCacheId_);
   }
+
+ private:
+  unsigned long long geometryCacheId_ = 0;
 };
 
 class PFRecHitEcalBarrelNavigator final : public PFRecHitCaloNavigator<EBDetId,EcalBarrelTopology> {
@@ -46,10 +64,11 @@ class PFRecHitEcalBarrelNavigator final : public PFRecHitCaloNavigator<EBDetId,E
   }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
-    edm::ESHandle<CaloGeometry> geoHandle;
-    iSetup.get<CaloGeometryRecord>().get(geoHandle);
-    topology_.reset( new EcalBarrelTopology(geoHandle) );
+    updateEcalTopology(iSetup, topology_, geometryCacheId_);
   }
+
+ private:
+  unsigned long long geometryCacheId_ = 0;
 };
 
 class PFRecHitEcalEndcapNavigator final : public PFRecHitCaloNavigator<EEDetId,EcalEndcapTopology> {
@@ -59,10 +78,11 @@ class PFRecHitEcalEndcapNavigator final : public PFRecHitCaloNavigator<EEDetId,E
   }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
-    edm::ESHandle<CaloGeometry> geoHandle;
-    iSetup.get<CaloGeometryRecord>().get(geoHandle);
-    topology_.reset( new EcalEndcapTopology(geoHandle) );
+    updateEcalTopology(iSetup, topology_, geometryCacheId_);
   }
+
+ private:
+  unsigned long long geometryCacheId_ = 0;
 };
 
 class PFRecHitPreshowerNavigator final : public PFRecHitCaloNavigator<ESDetId,EcalPreshowerTopology> {
@@ -73,10 +93,11 @@ class PFRecHitPreshowerNavigator final : public PFRecHitCaloNavigator<ESDetId,Ec
 
 
   void beginEvent(const edm::EventSetup& iSetup) override {
-    edm::ESHandle<CaloGeometry> geoHandle;
-    iSetup.get<CaloGeometryRecord>().get(geoHandle);
-    topology_.reset( new EcalPreshowerTopology(geoHandle) );
+    updateEcalTopology(iSetup, topology_, geometryCacheId_);
   }
+
+ private:
+  unsigned long long geometryCacheId_ = 0;
 };
 
 
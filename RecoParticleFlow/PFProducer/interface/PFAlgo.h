@@ -363,6 +363,8 @@ class PFAlgo {
   const edm::View<reco::PFCandidate> * pfEgammaCandidates_;
   const edm::ValueMap<reco::GsfElectronRef> * valueMapGedElectrons_;
   const edm::ValueMap<reco::PhotonRef> * valueMapGedPhotons_;  
+  /// egamma candidates indices sorted by the block of their first element
+  std::vector<std::pair<reco::PFBlockRef,unsigned> > egmCandidateBlocks_;
 
 
   // Option to let PF decide the muon momentum
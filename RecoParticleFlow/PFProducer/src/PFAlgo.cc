@@ -42,11 +42,19 @@
 #include "TDecompChol.h"
 
 #include <numeric>
+#include <algorithm>
 
 
 using namespace std;
 using namespace reco;
 
+namespace {
+  bool lessBlockRef(const std::pair<reco::PFBlockRef,unsigned>& a,
+                    const std::pair<reco::PFBlockRef,unsigned>& b) {
+    return a.first < b.first;
+  }
+}
+
 
 PFAlgo::PFAlgo()
   : pfCandidates_( new PFCandidateCollection),
@@ -439,6 +447,20 @@ void PFAlgo::reconstructParticles( const reco::PFBlockCollection& blocks ) {
   pfElectronExtra_.clear();
   pfPhotonExtra_.clear();
 
+  // index the egamma candidates by the block of their first element once,
+  // instead of scanning all of them for every block
+  egmCandidateBlocks_.clear();
+  if( useEGammaFilters_ ) {
+    const unsigned int negmcandidates = pfEgammaCandidates_->size();
+    egmCandidateBlocks_.reserve(negmcandidates);
+    for( unsigned int ieg = 0; ieg < negmcandidates; ++ieg ) {
+      const PFCandidate::ElementsInBlocks& theElements = (*pfEgammaCandidates_)[ieg].elementsInBlocks();
+      if( !theElements.empty() ) egmCandidateBlocks_.emplace_back(theElements.begin()->first, ieg);
+    }
+    // stable, so that candidates of the same block keep their original order
+    std::stable_sort(egmCandidateBlocks_.begin(), egmCandidateBlocks_.end(), lessBlockRef);
+  }
+
   if( debug_ ) {
     cout<<"*********************************************************"<<endl;
     cout<<"*****           Particle flow algorithm             *****"<<endl;
@@ -621,8 +643,11 @@ void PFAlgo::processBlock( const reco::PFBlockRef& blockref,
     bool egmLocalDebug = debug_;
     bool egmLocalBlockDebug = false;
 
-    unsigned int negmcandidates = pfEgammaCandidates_->size();
-    for(unsigned int ieg=0 ; ieg <  negmcandidates; ++ieg) {
+    // only the candidates whose first element is in this block are considered
+    const auto egmRange = std::equal_range(egmCandidateBlocks_.begin(), egmCandidateBlocks_.end(),
+                                           std::make_pair(blockref, 0u), lessBlockRef);
+    for(auto egmItr = egmRange.first; egmItr != egmRange.second; ++egmItr) {
+      const unsigned int ieg = egmItr->second;
       //      const reco::PFCandidate & egmcand((*pfEgammaCandidates_)[ieg]);
       reco::PFCandidateRef pfEgmRef = pfEgammaCandidates_->refAt(ieg).castTo<reco::PFCandidateRef>();
 
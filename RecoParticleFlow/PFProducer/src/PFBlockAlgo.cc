@@ -9,6 +9,7 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <iterator>
 #include "TMath.h"
 
 using namespace std;
@@ -200,9 +201,10 @@ reco::PFBlockCollection PFBlockAlgo::findBlocks() {
     auto& the_block = blocks.back();
     ElementList::value_type::pointer p1(elements_[range.first->second].get());
     the_block.addElement(p1);
-    const unsigned block_size = blocksmap.count(key) + 1;
-    //reserve up to 1M or 8MB; pay rehash cost for more
-    std::unordered_map<std::pair<unsigned int,unsigned int>, PFBlockLink > links(min(1000000u,block_size*block_size));
+    // only the links of the first element to the others are stored below,
+    // so the map never holds more than block_size-1 entries
+    const unsigned block_size = std::distance(range.first,range.second);
+    std::unordered_map<std::pair<unsigned int,unsigned int>, PFBlockLink > links(block_size);
     auto itr = range.first;
     ++itr;
     for( ; itr != range.second; ++itr ) {
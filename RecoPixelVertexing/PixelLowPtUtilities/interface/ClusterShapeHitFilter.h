@@ -211,7 +211,7 @@ class ClusterShapeHitFilter
 
 
   bool getSizes(DetId detId, const SiStripCluster & cluster, const LocalPoint &lpos, const LocalVector & ldir,
-     int & meas, float & pred) const;
+     int & meas, float & pred, StripData const * sd=nullptr) const;
   bool getSizes(const SiStripRecHit2D & recHit, const LocalPoint &lpos, const LocalVector & ldir,
      int & meas, float & pred) const {
     return getSizes(recHit.geographicalId(), recHit.stripCluster(), lpos, ldir, meas, pred);
@@ -219,7 +219,8 @@ class ClusterShapeHitFilter
   bool isCompatible(DetId detId,
                     const SiStripCluster & cluster,
                     const LocalPoint  & lpos,
-                    const LocalVector & ldir) const;
+                    const LocalVector & ldir,
+                    StripData const * sd=nullptr) const;
   bool isCompatible(DetId detId,
                     const SiStripCluster & cluster,
                     const LocalVector & ldir) const { 
@@ -272,7 +273,7 @@ class ClusterShapeHitFilter
     return (*p).second;
   }
 
-  const StripData & getsd(DetId id) const {return stripData.find(id)->second;}
+  const StripData & getsd(DetId id, StripData const * sd=nullptr) const {return sd ? *sd : stripData.find(id)->second;}
 
   void loadPixelLimits(std::string const & file, PixelLimits *plim);
   void loadStripLimits();
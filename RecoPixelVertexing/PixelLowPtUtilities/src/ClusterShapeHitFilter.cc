@@ -375,10 +375,10 @@ bool ClusterShapeHitFilter::isCompatible
 /*****************************************************************************/
 bool ClusterShapeHitFilter::getSizes
   (DetId id, const SiStripCluster & cluster, const LocalPoint &lpos, const LocalVector & ldir,
-   int & meas, float & pred) const 
+   int & meas, float & pred, StripData const * isd) const 
 {
   // Get detector
-  auto const & p=getsd(id);
+  auto const & p=getsd(id,isd);
 
   // Measured width
   meas   = cluster.amplitudes().size();
@@ -409,7 +409,8 @@ bool ClusterShapeHitFilter::getSizes
 
 /*****************************************************************************/
 bool ClusterShapeHitFilter::isCompatible
-  (DetId detId, const SiStripCluster & cluster, const LocalPoint & lpos, const LocalVector & ldir) const
+  (DetId detId, const SiStripCluster & cluster, const LocalPoint & lpos, const LocalVector & ldir,
+   StripData const * isd) const
 {
   int meas;
   float pred;
@@ -417,7 +418,7 @@ bool ClusterShapeHitFilter::isCompatible
   if (cutOnStripCharge_ && (!checkClusterCharge(detId, cluster, ldir))) return false;
   if (!cutOnStripShape_) return true;
 
-  if(getSizes(detId, cluster, lpos, ldir, meas, pred))
+  if(getSizes(detId, cluster, lpos, ldir, meas, pred, isd))
   {
     StripKeys key(meas);
     if (key.isValid())
@@ -433,17 +434,19 @@ bool ClusterShapeHitFilter::isCompatible
 bool ClusterShapeHitFilter::isCompatible
   (DetId detId, const SiStripCluster & cluster, const GlobalPoint &gpos, const GlobalVector & gdir) const
 {
-  const GeomDet *det = getsd(detId).det;
+  const StripData & sd = getsd(detId);
+  const GeomDet *det = sd.det;
   LocalVector ldir = det->toLocal(gdir);
   LocalPoint  lpos = det->toLocal(gpos); 
   // now here we do the transformation 
   lpos -= ldir * lpos.z()/ldir.z();
-  return isCompatible(detId, cluster, lpos, ldir);
+  return isCompatible(detId, cluster, lpos, ldir, &sd);
 }
 bool ClusterShapeHitFilter::isCompatible
   (DetId detId, const SiStripCluster & cluster, const GlobalVector & gdir) const
 {
-  return isCompatible(detId, cluster, getsd(detId).det->toLocal(gdir));
+  const StripData & sd = getsd(detId);
+  return isCompatible(detId, cluster, LocalPoint(0,0,0), sd.det->toLocal(gdir), &sd);
 }
 
 
@@ -149,9 +149,10 @@ std::unique_ptr<reco::Track> KFBasedPixelFitter::run(const std::vector<const Tra
   const TrackingRecHit* hit = nullptr;
   for ( unsigned int iHit = 0; iHit < hits.size(); iHit++) {
     hit = hits[iHit];
-    if (iHit==0) outerState = thePropagator->propagate(fts,theTracker->idToDet(hit->geographicalId())->surface());
     outerDetId = hit->geographicalId();
-    TrajectoryStateOnSurface state = thePropagator->propagate(outerState, theTracker->idToDet(outerDetId)->surface());
+    const Plane & surface = theTracker->idToDet(outerDetId)->surface();
+    if (iHit==0) outerState = thePropagator->propagate(fts,surface);
+    TrajectoryStateOnSurface state = thePropagator->propagate(outerState, surface);
     if (!state.isValid()) return ret;
 //    TransientTrackingRecHit::RecHitPointer recHit = (theTTRHBuilder->build(hit))->clone(state);
     TransientTrackingRecHit::RecHitPointer recHit =  theTTRHBuilder->build(hit);
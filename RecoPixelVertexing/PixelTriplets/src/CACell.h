@@ -3,6 +3,8 @@
 
 #include <array>
 #include <cmath>
+#include <utility>
+#include <vector>
 
 #include "DataFormats/Math/interface/deltaPhi.h"
 #include "RecoTracker/TkHitPairs/interface/RecHitsSortedInPhi.h"
@@ -98,27 +100,11 @@ public:
     return theDoublets->phi(theDoubletId, HitDoublets::outer);
   }
   
-  void evolve(unsigned int me, CAStatusColl& allStatus) {
-    
-    allStatus[me].hasSameStateNeighbors = 0;
-    auto mystate = allStatus[me].theCAState;
-    
-    for (auto oc : theOuterNeighbors ) {
-      
-      if (allStatus[oc].getCAState() == mystate) {
-	
-	allStatus[me].hasSameStateNeighbors = 1;
-	
-	break;
-      }
-    }
-    
-  }
-  
-
+  // calls act(innerCell, thisCell) for each cell in innerCells compatible with this one
+  template<typename F>
   void checkAlignmentAndAct(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
 			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
-			    const float phiCut, const float hardPtCut, std::vector<CACell::CAntuplet> * foundTriplets) {
+			    const float phiCut, const float hardPtCut, F&& act) {
     int ncells = innerCells.size();
     int constexpr VSIZE = 16;
     int ok[VSIZE];
@@ -141,10 +127,7 @@ public:
 	auto & oc =  allCells[koc]; 
 	if (ok[j]&&haveSimilarCurvature(oc,ptmin, region_origin_x, region_origin_y,
 					region_origin_radius, phiCut, hardPtCut)) {
-	  if (foundTriplets) foundTriplets->emplace_back(CACell::CAntuplet{koc,cellId});
-	  else {
-	    oc.tagAsOuterNeighbor(cellId);
-	  }
+	  act(koc, cellId);
 	}
       }
     };
@@ -154,11 +137,13 @@ public:
     
   }
   
-  void checkAlignmentAndTag(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
+  // records the (inner, outer) pairs of neighboring cells; see CellularAutomaton::connectCells
+  void checkAlignmentAndTag(CAColl& allCells, CAntuple & innerCells, std::vector<std::pair<unsigned int, unsigned int>>& neighborPairs,
+			    const float ptmin, const float region_origin_x,
 			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
 			    const float phiCut, const float hardPtCut) {
     checkAlignmentAndAct(allCells, innerCells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
-			 phiCut, hardPtCut, nullptr);
+			 phiCut, hardPtCut, [&](unsigned int inner, unsigned int outer) { neighborPairs.emplace_back(inner, outer); });
     
   }
   void checkAlignmentAndPushTriplet(CAColl& allCells, CAntuple & innerCells, std::vector<CACell::CAntuplet>& foundTriplets,
@@ -166,7 +151,7 @@ public:
 				    const float region_origin_radius, const float thetaCut, const float phiCut,
 				    const float hardPtCut) {
     checkAlignmentAndAct(allCells, innerCells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
-			 phiCut, hardPtCut, &foundTriplets);
+			 phiCut, hardPtCut, [&](unsigned int inner, unsigned int outer) { foundTriplets.emplace_back(CACell::CAntuplet{inner, outer}); });
   }
   
   
@@ -182,12 +167,6 @@ public:
   }
   
   
-  void tagAsOuterNeighbor(unsigned int otherCell)
-  {
-    theOuterNeighbors.push_back(otherCell);
-  }
-  
-  
   bool haveSimilarCurvature(const CACell & otherCell, const float ptmin,
 			    const float region_origin_x, const float region_origin_y, const float region_origin_radius, const float phiCut, const float hardPtCut) const
   {
@@ -257,37 +236,8 @@ public:
   }
   
   
-  // trying to free the track building process from hardcoded layers, leaving the visit of the graph
-  // based on the neighborhood connections between cells.
-  
-  void findNtuplets(CAColl& allCells, std::vector<CAntuplet>& foundNtuplets, CAntuplet& tmpNtuplet, const unsigned int minHitsPerNtuplet) const {
-    
-    // the building process for a track ends if:
-    // it has no outer neighbor
-    // it has no compatible neighbor
-    // the ntuplets is then saved if the number of hits it contains is greater than a threshold
-    
-    if (tmpNtuplet.size() == minHitsPerNtuplet - 1)
-      {
-	foundNtuplets.push_back(tmpNtuplet);
-      }
-    else
-      {
-	unsigned int numberOfOuterNeighbors = theOuterNeighbors.size();
-	for (unsigned int i = 0; i < numberOfOuterNeighbors; ++i) {
-	  tmpNtuplet.push_back((theOuterNeighbors[i]));
-	  allCells[theOuterNeighbors[i]].findNtuplets(allCells,foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
-	  tmpNtuplet.pop_back();
-	}
-      }
-    
-  }
-  
-  
 private:
   
-  CAntuple theOuterNeighbors;
-  
   const HitDoublets* theDoublets;  
   const int theDoubletId;
   
@@ -61,7 +61,7 @@ void CellularAutomaton::createAndConnectCells(
 
           auto & neigCells = currentInnerLayerRef.isOuterHitOfCell[doubletLayerPairId->innerHitId(i)];
           allCells.back().checkAlignmentAndTag(
-              allCells, neigCells, ptmin, region_origin_x, region_origin_y,
+              allCells, neigCells, theNeighborPairs, ptmin, region_origin_x, region_origin_y,
               region_origin_radius, thetaCut, phiCut, hardPtCut);
         }
         assert(cellId == currentLayerPairRef.theFoundCells[1]);
@@ -78,25 +78,58 @@ void CellularAutomaton::createAndConnectCells(
       }
     }
   }
+  connectCells();
+}
+
+void CellularAutomaton::connectCells()
+{
+  // Store the outer neighbors of all cells in one flat array indexed by
+  // theOuterNeighborsBegin, keeping the order in which they were found.
+  auto nCells = allCells.size();
+  theOuterNeighborsBegin.assign(nCells + 1, 0);
+  for (auto const& pair : theNeighborPairs) {
+    ++theOuterNeighborsBegin[pair.first + 1];
+  }
+  for (unsigned int i = 0; i < nCells; ++i) {
+    theOuterNeighborsBegin[i + 1] += theOuterNeighborsBegin[i];
+  }
+  theOuterNeighbors.resize(theNeighborPairs.size());
+  std::vector<unsigned int> next(theOuterNeighborsBegin.begin(), theOuterNeighborsBegin.end() - 1);
+  for (auto const& pair : theNeighborPairs) {
+    theOuterNeighbors[next[pair.first]++] = pair.second;
+  }
+  theNeighborPairs.clear();
+}
+
+void CellularAutomaton::evolveCell(unsigned int cell)
+{
+  auto & status = allStatus[cell];
+  status.hasSameStateNeighbors = 0;
+  auto mystate = status.theCAState;
+  for (auto i = theOuterNeighborsBegin[cell]; i < theOuterNeighborsBegin[cell + 1]; ++i) {
+    if (allStatus[theOuterNeighbors[i]].getCAState() == mystate) {
+      status.hasSameStateNeighbors = 1;
+      break;
+    }
+  }
 }
 
 void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
 {
   allStatus.resize(allCells.size());
+  unsigned int nCells = allCells.size();
 
   unsigned int numberOfIterations = minHitsPerNtuplet - 2;
   // keeping the last iteration for later
+  // each cell belongs to exactly one layer pair, and the states only change in
+  // the second sweep, so the cells can be visited in storage order
   for (unsigned int iteration = 0; iteration < numberOfIterations - 1; ++iteration) {
-    for (auto & layerPair : theLayerGraph.theLayerPairs) {
-      for (auto i = layerPair.theFoundCells[0]; i < layerPair.theFoundCells[1]; ++i) {
-        allCells[i].evolve(i, allStatus);
-      }
+    for (unsigned int i = 0; i < nCells; ++i) {
+      evolveCell(i);
     }
 
-    for (auto & layerPair : theLayerGraph.theLayerPairs) {
-      for (auto i = layerPair.theFoundCells[0]; i < layerPair.theFoundCells[1]; ++i) {
-        allStatus[i].updateState();
-      }
+    for (auto & status : allStatus) {
+      status.updateState();
     }
   }
 
@@ -107,7 +140,7 @@ void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
       auto foundCells = theLayerGraph.theLayerPairs[rootLayerPair].theFoundCells;
       for (auto i = foundCells[0]; i < foundCells[1]; ++i) {
         auto & cell = allStatus[i];
-        allCells[i].evolve(i, allStatus);
+        evolveCell(i);
         cell.updateState();
         if (cell.isRootCell(minHitsPerNtuplet - 2)) {
           theRootCells.push_back(i);
@@ -126,7 +159,26 @@ void CellularAutomaton::findNtuplets(std::vector<CACell::CAntuplet> & foundNtupl
   {
     tmpNtuplet.clear();
     tmpNtuplet.push_back(root_cell);
-    allCells[root_cell].findNtuplets(allCells, foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
+    findNtupletsFrom(root_cell, foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
+  }
+}
+
+void CellularAutomaton::findNtupletsFrom(unsigned int cell, std::vector<CACell::CAntuplet> & foundNtuplets,
+                                         CACell::CAntuplet & tmpNtuplet, const unsigned int minHitsPerNtuplet) const
+{
+  // the building process for a track ends if:
+  // it has no outer neighbor
+  // it has no compatible neighbor
+  // the ntuplets is then saved if the number of hits it contains is greater than a threshold
+  if (tmpNtuplet.size() == minHitsPerNtuplet - 1) {
+    foundNtuplets.push_back(tmpNtuplet);
+  } else {
+    for (auto i = theOuterNeighborsBegin[cell]; i < theOuterNeighborsBegin[cell + 1]; ++i) {
+      auto outerCell = theOuterNeighbors[i];
+      tmpNtuplet.push_back(outerCell);
+      findNtupletsFrom(outerCell, foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
+      tmpNtuplet.pop_back();
+    }
   }
 }
 
@@ -2,6 +2,8 @@
 #define RecoPixelVertexing_PixelTriplets_src_CellularAutomaton_h
 
 #include <array>
+#include <utility>
+#include <vector>
 
 #include "RecoTracker/TkTrackingRegions/interface/TrackingRegion.h"
 #include "TrackingTools/TransientTrackingRecHit/interface/SeedingLayerSetsHits.h"
@@ -27,11 +29,20 @@ public:
 		    const float thetaCut, const float phiCut, const float hardPtCut);
   
 private:
+  void connectCells();
+  void evolveCell(unsigned int);
+  void findNtupletsFrom(unsigned int, std::vector<CACell::CAntuplet>&, CACell::CAntuplet&, const unsigned int) const;
+
   CAGraph & theLayerGraph;
 
   std::vector<CACell> allCells;
   std::vector<CACellStatus> allStatus;
 
+  // outer neighbors of cell i are theOuterNeighbors[theOuterNeighborsBegin[i]..theOuterNeighborsBegin[i+1])
+  std::vector<std::pair<unsigned int, unsigned int> > theNeighborPairs;
+  std::vector<unsigned int> theOuterNeighborsBegin;
+  std::vector<unsigned int> theOuterNeighbors;
+
   std::vector<unsigned int> theRootCells;
   std::vector<std::vector<CACell*> > theNtuplets;
   
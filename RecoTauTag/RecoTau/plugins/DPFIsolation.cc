@@ -129,8 +129,16 @@ private:
         static constexpr float pfCandPixHits_max = 7.f;
         static constexpr float pfCandHits_max = 30.f;
 
+        // the pt ordering of the candidates does not depend on the tau
+        std::vector<unsigned int> sorted_inds(pfcands->size());
+        std::size_t n = 0;
+        std::generate(std::begin(sorted_inds), std::end(sorted_inds), [&]{ return n++; });
+
+        std::sort(std::begin(sorted_inds), std::end(sorted_inds),
+        [&](int i1, int i2) { return pfcands->at(i1).pt() > pfcands->at(i2).pt(); } );
+
         for(size_t tau_index = 0; tau_index < taus->size(); tau_index++) {
-            pat::Tau tau = taus->at(tau_index);
+            const pat::Tau& tau = taus->at(tau_index);
             bool isGoodTau = false;
             const float lepRecoPt = tau.pt();
             const float lepRecoPz = std::abs(tau.pz());
@@ -161,15 +169,8 @@ private:
             unsigned int iPF = 0;
             const unsigned max_iPF = getNumberOfParticles(graphVersion);
 
-            std::vector<unsigned int> sorted_inds(pfcands->size());
-            std::size_t n = 0;
-            std::generate(std::begin(sorted_inds), std::end(sorted_inds), [&]{ return n++; });
-
-            std::sort(std::begin(sorted_inds), std::end(sorted_inds),
-            [&](int i1, int i2) { return pfcands->at(i1).pt() > pfcands->at(i2).pt(); } );
-
             for(size_t pf_index = 0; pf_index < pfcands->size() && iPF < max_iPF; pf_index++) {
-                pat::PackedCandidate p = pfcands->at(sorted_inds.at(pf_index));
+                const pat::PackedCandidate& p = pfcands->at(sorted_inds.at(pf_index));
                 float deltaR_tau_p =  deltaR(p.p4(),tau.p4());
 
                 if (p.pt() < 0.5) continue;
@@ -234,7 +234,10 @@ void PFRecoTauChargedHadronProducer::produce(edm::Event& evt, const edm::EventSe
 	for ( std::list<etaPhiPair>::const_iterator trackInCleanCollection = tracksInCleanCollection.begin();
 	      trackInCleanCollection != tracksInCleanCollection.end(); ++trackInCleanCollection ) {
 	  double dR = deltaR(track_eta, track_phi, trackInCleanCollection->first, trackInCleanCollection->second);
-	  if ( dR < 1.e-4 ) isTrack_overlap = true;
+	  if ( dR < 1.e-4 ) {
+	    isTrack_overlap = true;
+	    break;
+	  }
 	}
       }
       if ( verbosity_ ) {
@@ -245,10 +248,7 @@ void PFRecoTauChargedHadronProducer::produce(edm::Event& evt, const edm::EventSe
       // discard ChargedHadron candidates without track in case they are close to neutral PFCandidates "used" by ChargedHadron candidates in the clean collection
       bool isNeutralPFCand_overlap = false;
       if ( nextChargedHadron->algoIs(reco::PFRecoTauChargedHadron::kPFNeutralHadron) ) {
-	for ( std::set<reco::PFCandidatePtr>::const_iterator neutralPFCandInCleanCollection = neutralPFCandsInCleanCollection.begin();
-	      neutralPFCandInCleanCollection != neutralPFCandsInCleanCollection.end(); ++neutralPFCandInCleanCollection ) {
-	  if ( (*neutralPFCandInCleanCollection) == nextChargedHadron->getChargedPFCandidate() ) isNeutralPFCand_overlap = true;
-	}
+	isNeutralPFCand_overlap = ( neutralPFCandsInCleanCollection.count(nextChargedHadron->getChargedPFCandidate()) > 0 );
       }
       if ( verbosity_ ) {
 	edm::LogPrint("PFRecoTauChHProducer")<< "isNeutralPFCand_overlap = " << isNeutralPFCand_overlap ;
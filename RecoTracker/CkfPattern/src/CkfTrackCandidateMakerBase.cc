@@ -261,14 +261,24 @@ namespace cms{
       // std::cout << spt(indeces[0]) << ' ' << spt(indeces[collseed_size-1]) << std::endl;
 #endif
 
+#if !defined(VI_TBB) && !defined(VI_OMP)
+      // the seeds are processed one after the other: share the per-seed
+      // trajectory container so that its capacity is reused across seeds
+      std::vector<Trajectory> theSharedTmpTrajectories;
+#endif
+
       std::atomic<unsigned int> ntseed(0);
       auto theLoop = [&](size_t ii) {
         auto j = indeces[ii];
 
         ntseed++;
 
+#if defined(VI_TBB) || defined(VI_OMP)
         // to be moved inside a par section (how with tbb??)
         std::vector<Trajectory> theTmpTrajectories;
+#else
+        auto & theTmpTrajectories = theSharedTmpTrajectories;
+#endif
 
 
 	LogDebug("CkfPattern") << "======== Begin to look for trajectories from seed " << j << " ========\n";
@@ -197,11 +197,14 @@ limitedCandidates(const boost::shared_ptr<const TrajectorySeed> & sharedSeed, Te
   };
   
  
+  // reused for all candidates to avoid an allocation per candidate and iteration
+  std::vector<TM> meas;
+
   while ( !candidates.empty()) {
 
     newCand.clear();
     for (auto traj=candidates.begin(); traj!=candidates.end(); traj++) {
-      std::vector<TM> meas;
+      meas.clear();
       findCompatibleMeasurements(*sharedSeed, *traj, meas);
 
       // --- method for debugging
@@ -225,7 +228,8 @@ limitedCandidates(const boost::shared_ptr<const TrajectorySeed> & sharedSeed, Te
 	}
 
 	for(auto itm = meas.begin(); itm != last; itm++) {
-	  TempTrajectory newTraj = *traj;
+	  // the candidate is not needed after its last continuation, so move it instead of copying
+	  TempTrajectory newTraj = (itm+1 == last) ? std::move(*traj) : *traj;
 	  updateTrajectory( newTraj, std::move(*itm));
 
 	  if ( toBeContinued(newTraj)) {
@@ -342,6 +346,7 @@ CkfTrajectoryBuilder::findCompatibleMeasurements(const TrajectorySeed&seed,
   auto layerEnd  = stateAndLayers.second.end();
   LogDebug("CkfPattern")<<"looping on "<< stateAndLayers.second.size()<<" layers.";
   const Propagator *fwdPropagator = forwardPropagator(seed);
+  LayerMeasurements layerMeasurements(theMeasurementTracker->measurementTracker(), *theMeasurementTracker);
   for (auto il = layerBegin;  il != layerEnd; il++) {
 
     LogDebug("CkfPattern")<<"looping on a layer in findCompatibleMeasurements.\n last layer: "<<traj.lastLayer()<<" current layer: "<<(*il);
@@ -360,7 +365,6 @@ CkfTrajectoryBuilder::findCompatibleMeasurements(const TrajectorySeed&seed,
 	LogDebug("CkfPattern")<<"to: "<<stateToUse;
       }
     
-    LayerMeasurements layerMeasurements(theMeasurementTracker->measurementTracker(), *theMeasurementTracker);
     std::vector<TrajectoryMeasurement> && tmp = layerMeasurements.measurements((**il),stateToUse, *fwdPropagator, *theEstimator);
     
     if ( !tmp.empty()) {
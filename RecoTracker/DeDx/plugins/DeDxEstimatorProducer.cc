@@ -124,14 +124,16 @@ void DeDxEstimatorProducer::produce(edm::Event& iEvent, const edm::EventSetup& i
      auto const & trajParams = track->extra()->trajParams();
      assert(trajParams.size()==track->recHitsSize());
      auto hb = track->recHitsBegin();
-        dedxHits.reserve(track->recHitsSize()/2);
-        for(unsigned int h=0;h<track->recHitsSize();h++){
+     const unsigned int nRecHits = track->recHitsSize();
+     const float trackMomentum = track->p();
+        dedxHits.reserve(nRecHits/2);
+        for(unsigned int h=0;h<nRecHits;h++){
            auto recHit = *(hb+h);
            if (!trackerHitRTTI::isFromDet(*recHit) ) continue;
 
            auto trackDirection = trajParams[h].direction();         
            float cosine = trackDirection.z()/trackDirection.mag();
-           processHit(recHit, track->p(), cosine, dedxHits, NClusterSaturating);
+           processHit(recHit, trackMomentum, cosine, dedxHits, NClusterSaturating);
         } 
 
      sort(dedxHits.begin(),dedxHits.end(),less<DeDxHit>());   
@@ -42,12 +42,13 @@ struct mva {
 		   reco::BeamSpot const & beamSpot,
 		   reco::VertexCollection const & vertices) const {
 
+    const reco::HitPattern & hitPattern = trk.hitPattern();
     auto tmva_pt_ = trk.pt();
     auto tmva_ndof_ = trk.ndof();
-    auto tmva_nlayers_ = trk.hitPattern().trackerLayersWithMeasurement();
-    auto tmva_nlayers3D_ = trk.hitPattern().pixelLayersWithMeasurement()
-        + trk.hitPattern().numberOfValidStripLayersWithMonoAndStereo();
-    auto tmva_nlayerslost_ = trk.hitPattern().trackerLayersWithoutMeasurement(reco::HitPattern::TRACK_HITS);
+    auto tmva_nlayers_ = hitPattern.trackerLayersWithMeasurement();
+    auto tmva_nlayers3D_ = hitPattern.pixelLayersWithMeasurement()
+        + hitPattern.numberOfValidStripLayersWithMonoAndStereo();
+    auto tmva_nlayerslost_ = hitPattern.trackerLayersWithoutMeasurement(reco::HitPattern::TRACK_HITS);
     float chi2n =  trk.normalizedChi2();
     float chi2n_no1Dmod = chi2n;
     
@@ -67,10 +68,12 @@ struct mva {
     auto tmva_eta_ = trk.eta();
     auto tmva_relpterr_ = float(trk.ptError())/std::max(float(trk.pt()),0.000001f);
     auto tmva_nhits_ = trk.numberOfValidHits();
-    int lostIn = trk.hitPattern().numberOfLostHits(reco::HitPattern::MISSING_INNER_HITS);
-    int lostOut = trk.hitPattern().numberOfLostHits(reco::HitPattern::MISSING_OUTER_HITS);
+    int lostIn = hitPattern.numberOfLostHits(reco::HitPattern::MISSING_INNER_HITS);
+    int lostOut = hitPattern.numberOfLostHits(reco::HitPattern::MISSING_OUTER_HITS);
     auto tmva_minlost_ = std::min(lostIn,lostOut);
-    auto tmva_lostmidfrac_ = static_cast<float>(trk.numberOfLostHits()) / static_cast<float>(trk.numberOfValidHits() + trk.numberOfLostHits());
+    // each hit count is a scan of the hit pattern: compute them once
+    auto nLostHits = trk.numberOfLostHits();
+    auto tmva_lostmidfrac_ = static_cast<float>(nLostHits) / static_cast<float>(tmva_nhits_ + nLostHits);
    
     float gbrVals_[PROMPT ? 16 : 12];
     gbrVals_[0] = tmva_pt_;
@@ -474,6 +474,13 @@ TrackListMerger::~TrackListMerger() { }
 
       for ( unsigned int i=0; i<rSize; i++) saveSelected[i]=selected[i];
 
+      auto share = use_sharesInput_ ?
+	[](const TrackingRecHit*  it,const TrackingRecHit*  jt, float)->bool { return it->sharesInput(jt,TrackingRecHit::some); } :
+      [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float eps)->bool {
+	float delta = std::abs ( it->localPosition().x()-jt->localPosition().x() );
+	return (it->geographicalId()==jt->geographicalId())&&(delta<eps);
+      };
+
       //DL protect against 0 tracks?
       for ( unsigned int i=0; i<rSize-1; i++) {
 	if (selected[i]==0) continue;
@@ -509,13 +516,6 @@ TrackListMerger::~TrackListMerger() { }
 	  int nhit2 = nh2;
 
 
-	  auto share = use_sharesInput_ ?
-	    [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float)->bool { return it->sharesInput(jt,TrackingRecHit::some); } :
-	  [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float eps)->bool {
-	    float delta = std::abs ( it->localPosition().x()-jt->localPosition().x() );
-	    return (it->geographicalId()==jt->geographicalId())&&(delta<eps);
-	  };
-
 	  statCount.start();
 
 	  //loop over rechits
@@ -532,6 +532,9 @@ TrackListMerger::~TrackListMerger() { }
 	  // exploit sorting
 	  unsigned int jh=0;
 	  unsigned int ih=0;
+	  // no common id if the (sorted) id ranges do not intersect
+	  if (nh1!=0 && nh2!=0 &&
+	      (rh1[k1][nh1-1].first<rh1[k2][0].first || rh1[k2][nh2-1].first<rh1[k1][0].first)) ih=nh1;
 	  while (ih!=nh1 && jh!=nh2) {
 	    // break if not enough to go...
 	    // if ( nprecut-noverlap+firstoverlap > int(nh1-ih)) break;
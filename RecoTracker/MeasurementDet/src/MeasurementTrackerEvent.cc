@@ -19,6 +19,7 @@ MeasurementTrackerEvent::MeasurementTrackerEvent(MeasurementTrackerEvent && othe
   other.theOwner = false; // make sure to fully transfer the ownership
   theStripClustersToSkip = std::move(other.theStripClustersToSkip);
   thePixelClustersToSkip = std::move(other.thePixelClustersToSkip);
+  thePhase2OTClustersToSkip = std::move(other.thePhase2OTClustersToSkip);
 }
 MeasurementTrackerEvent& MeasurementTrackerEvent::operator=(MeasurementTrackerEvent && other) {
   theTracker = std::move(other.theTracker);
@@ -29,6 +30,7 @@ MeasurementTrackerEvent& MeasurementTrackerEvent::operator=(MeasurementTrackerEv
   other.theOwner = false; // make sure to fully transfer the ownership
   theStripClustersToSkip = std::move(other.theStripClustersToSkip);
   thePixelClustersToSkip = std::move(other.thePixelClustersToSkip);
+  thePhase2OTClustersToSkip = std::move(other.thePhase2OTClustersToSkip);
   return *this;
 }
 
@@ -52,10 +54,8 @@ MeasurementTrackerEvent::MeasurementTrackerEvent(const MeasurementTrackerEvent &
         throw cms::Exception("Configuration")<<"The pixel masking does not point to the proper collection of clusters: "<<pixelClustersToSkip.refProd().id()<<"!="<<thePixelData->handle().id()<<"\n";
     }
 
-    theStripClustersToSkip.resize(stripClustersToSkip.size());
     stripClustersToSkip.copyMaskTo(theStripClustersToSkip);
 
-    thePixelClustersToSkip.resize(pixelClustersToSkip.size());
     pixelClustersToSkip.copyMaskTo(thePixelClustersToSkip);
 }
 
@@ -80,9 +80,7 @@ MeasurementTrackerEvent::MeasurementTrackerEvent(const MeasurementTrackerEvent &
         throw cms::Exception("Configuration")<<"The pixel masking does not point to the proper collection of clusters: "<<pixelClustersToSkip.refProd().id()<<"!="<<thePixelData->handle().id()<<"\n";
     }
 
-    thePixelClustersToSkip.resize(pixelClustersToSkip.size());
     pixelClustersToSkip.copyMaskTo(thePixelClustersToSkip);
 
-    thePhase2OTClustersToSkip.resize(phase2OTClustersToSkip.size());
     phase2OTClustersToSkip.copyMaskTo(thePhase2OTClustersToSkip);
 }
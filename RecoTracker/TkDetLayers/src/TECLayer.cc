@@ -48,6 +48,20 @@ namespace {
 							 theZmin-zPos, theZmax-zPos));
   }
 
+  template<typename R>
+  vector<R>
+  computePhiRanges( const vector<const TECPetal*>& petals) {
+    vector<R> result;
+    result.reserve(petals.size());
+    for (auto petal : petals) {
+      const BoundDiskSector &  diskSector = petal->specificSurface();
+      result.push_back({diskSector.phi(),
+                        {diskSector.phi() - diskSector.phiHalfExtension(),
+                         diskSector.phi() + diskSector.phiHalfExtension()}});
+    }
+    return result;
+  }
+
 }
 
 
@@ -85,6 +99,9 @@ TECLayer::TECLayer(vector<const TECPetal*>& innerPetals,
   theBackBinFinder  = BinFinderPhi(theBackComps.front()->position().phi(),
 				   theBackComps.size());  
 
+  theFrontPhiRanges = computePhiRanges<PetalPhiRange>( theFrontComps);
+  theBackPhiRanges  = computePhiRanges<PetalPhiRange>( theBackComps);
+
   //--------- DEBUG INFO --------------
   LogDebug("TkDetLayers") << "DEBUG INFO for TECLayer" << "\n"
 			  << "TECLayer z,perp, innerRadius, outerR: " 
@@ -209,9 +226,9 @@ SubLayerCrossings TECLayer::computeCrossings(const TrajectoryStateOnSurface& sta
   
   // 0ss: frontDisk has index=0, backDisk has index=1
   float frontDist = std::abs(Geom::deltaPhi( gFrontPoint.barePhi(), 
-					     theFrontComps[frontIndex]->surface().phi()) );
+					     theFrontPhiRanges[frontIndex].phi) );
   float backDist = std::abs(Geom::deltaPhi( gBackPoint.barePhi(), 
-					    theBackComps[backIndex]->surface().phi()) );
+					    theBackPhiRanges[backIndex].phi) );
   
 
   if (frontDist < backDist) {
@@ -243,13 +260,9 @@ bool TECLayer::addClosest( const TrajectoryStateOnSurface& tsos,
 
 namespace {
   inline
-  bool overlap(float phi, const TECPetal& gsdet, float phiWin) {
+  bool overlap(float phi, const pair<float,float>& petalPhiRange, float phiWin) {
     
-    const BoundDiskSector &  diskSector = gsdet.specificSurface();
     pair<float,float> phiRange(phi-phiWin,phi+phiWin);
-    pair<float,float> petalPhiRange(diskSector.phi() - diskSector.phiHalfExtension(),
-				    diskSector.phi() + diskSector.phiHalfExtension());
-    
     
     return rangesIntersect(phiRange, petalPhiRange,
             [](auto x,auto y){ return Geom::phiLess(x, y);});
@@ -269,13 +282,14 @@ void TECLayer::searchNeighbors( const TrajectoryStateOnSurface& tsos,
   auto gphi = gCrossingPos.barePhi();  
 
   const auto & sLayer( subLayer( crossing.subLayerIndex()));
+  const auto & sPhiRanges( subLayerPhiRanges( crossing.subLayerIndex()));
  
   int closestIndex = crossing.closestDetIndex();
   int negStartIndex = closestIndex-1;
   int posStartIndex = closestIndex+1;
 
   if (checkClosest) { // must decide if the closest is on the neg or pos side
-    if ( Geom::phiLess( gphi, sLayer[closestIndex]->surface().phi())) {
+    if ( Geom::phiLess( gphi, sPhiRanges[closestIndex].phi)) {
       posStartIndex = closestIndex;
     }
     else {
@@ -288,15 +302,15 @@ void TECLayer::searchNeighbors( const TrajectoryStateOnSurface& tsos,
   typedef CompatibleDetToGroupAdder Adder;
   int half = sLayer.size()/2;  // to check if dets are called twice....
   for (int idet=negStartIndex; idet >= negStartIndex - half; idet--) {
-    const auto & neighborPetal = *sLayer[binFinder.binIndex(idet)];
-    if (!overlap( gphi, neighborPetal, window)) break;
-    if (!Adder::add( neighborPetal, tsos, prop, est, result)) break;
+    int ibin = binFinder.binIndex(idet);
+    if (!overlap( gphi, sPhiRanges[ibin].range, window)) break;
+    if (!Adder::add( *sLayer[ibin], tsos, prop, est, result)) break;
     // maybe also add shallow crossing angle test here???
   }
   for (int idet=posStartIndex; idet < posStartIndex + half; idet++) {
-    const auto & neighborPetal = *sLayer[binFinder.binIndex(idet)];
-    if (!overlap( gphi, neighborPetal, window)) break;
-    if (!Adder::add( neighborPetal, tsos, prop, est, result)) break;
+    int ibin = binFinder.binIndex(idet);
+    if (!overlap( gphi, sPhiRanges[ibin].range, window)) break;
+    if (!Adder::add( *sLayer[ibin], tsos, prop, est, result)) break;
     // maybe also add shallow crossing angle test here???
   }
 }
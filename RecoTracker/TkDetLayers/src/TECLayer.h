@@ -62,6 +62,17 @@ class TECLayer : public ForwardDetLayer  {
     return (ind==0 ? theFrontComps : theBackComps);
   }
 
+  // phi of a petal and its phi extension, cached at construction so that
+  // the neighbour search does not go through the petal surface every time
+  struct PetalPhiRange {
+    float phi;
+    std::pair<float,float> range;
+  };
+
+  const std::vector<PetalPhiRange>& subLayerPhiRanges( int ind) const {
+    return (ind==0 ? theFrontPhiRanges : theBackPhiRanges);
+  }
+
 
  protected:
 
@@ -80,6 +91,9 @@ class TECLayer : public ForwardDetLayer  {
   BinFinderPhi theFrontBinFinder;
   BinFinderPhi theBackBinFinder;
 
+  std::vector<PetalPhiRange> theFrontPhiRanges;
+  std::vector<PetalPhiRange> theBackPhiRanges;
+
   
 };
 
@@ -83,6 +83,9 @@ TIBLayer::TIBLayer(std::vector<const TIBRing*>& innerRings,
  
   theOuterBinFinder = GeneralBinFinderInZforGeometricSearchDet<float>(theOuterComps.begin(),
 								      theOuterComps.end());
+
+  theInnerZRanges = zRanges( theInnerComps);
+  theOuterZRanges = zRanges( theOuterComps);
 }
 
 TIBLayer::~TIBLayer(){} 
@@ -120,15 +123,24 @@ TIBLayer::cylinder( const std::vector<const GeometricSearchDet*>& rings)
 }
 
 
+std::vector<TIBLayer::RingZRange>
+TIBLayer::zRanges( const std::vector<const GeometricSearchDet*>& rings)
+{
+  std::vector<RingZRange> result;
+  result.reserve(rings.size());
+  for (auto ring : rings)
+    result.push_back({ring->surface().position().z(), 0.5f*ring->surface().bounds().length()});
+  return result;
+}
+
+
 std::tuple<bool,int,int>  TIBLayer::computeIndexes(GlobalPoint gInnerPoint, GlobalPoint gOuterPoint) const {
 
   int innerIndex = theInnerBinFinder.binIndex(gInnerPoint.z());
-  const GeometricSearchDet* innerRing =  theInnerComps[innerIndex];
-  float innerDist = std::abs( innerRing->surface().position().z() - gInnerPoint.z());
+  float innerDist = std::abs( theInnerZRanges[innerIndex].z - gInnerPoint.z());
 
   int outerIndex = theOuterBinFinder.binIndex(gOuterPoint.z());
-  const GeometricSearchDet* outerRing = theOuterComps[outerIndex];
-  float outerDist = std::abs( outerRing->surface().position().z() - gOuterPoint.z());
+  float outerDist = std::abs( theOuterZRanges[outerIndex].z - gOuterPoint.z());
 
 
   return std::make_tuple(innerDist < outerDist,innerIndex, outerIndex);
@@ -147,13 +159,14 @@ void TIBLayer::searchNeighbors( const TrajectoryStateOnSurface& tsos,
   const GlobalPoint& gCrossingPos = crossing.position();
 
   const std::vector<const GeometricSearchDet*>& sLayer( subLayer( crossing.subLayerIndex()));
+  const std::vector<RingZRange>& sZRanges( subLayerZRanges( crossing.subLayerIndex()));
  
   int closestIndex = crossing.closestDetIndex();
   int negStartIndex = closestIndex-1;
   int posStartIndex = closestIndex+1;
 
   if (checkClosest) { // must decide if the closest is on the neg or pos side
-    if (gCrossingPos.z() < sLayer[closestIndex]->surface().position().z()) {
+    if (gCrossingPos.z() < sZRanges[closestIndex].z) {
       posStartIndex = closestIndex;
     }
     else {
@@ -163,26 +176,22 @@ void TIBLayer::searchNeighbors( const TrajectoryStateOnSurface& tsos,
 
   typedef CompatibleDetToGroupAdder Adder;
   for (int idet=negStartIndex; idet >= 0; idet--) {
-    const GeometricSearchDet* neighborRing = sLayer[idet];
-    if (!overlap( gCrossingPos, *neighborRing, window)) break;
-    if (!Adder::add( *neighborRing, tsos, prop, est, result)) break;
+    if (!overlap( gCrossingPos, sZRanges[idet], window)) break;
+    if (!Adder::add( *sLayer[idet], tsos, prop, est, result)) break;
   }
   for (int idet=posStartIndex; idet < static_cast<int>(sLayer.size()); idet++) {
-    const GeometricSearchDet* neighborRing = sLayer[idet];
-    if (!overlap( gCrossingPos, *neighborRing, window)) break;
-    if (!Adder::add( *neighborRing, tsos, prop, est, result)) break;
+    if (!overlap( gCrossingPos, sZRanges[idet], window)) break;
+    if (!Adder::add( *sLayer[idet], tsos, prop, est, result)) break;
   }
 }
 
 bool TIBLayer::overlap( const GlobalPoint& crossPoint,
-			const GeometricSearchDet& det, 
+			const RingZRange& ring, 
 			float window)
 {
-  float halfLength = 0.5f*det.surface().bounds().length();
-
-//   edm::LogInfo(TkDetLayers) << " TIBLayer: checking ring with z " << det.position().z();
+//   edm::LogInfo(TkDetLayers) << " TIBLayer: checking ring with z " << ring.z;
 
-  return std::abs( crossPoint.z()-det.position().z()) < (halfLength + window);
+  return std::abs( crossPoint.z()-ring.z) < (ring.halfLength + window);
 }
 
 float TIBLayer::computeWindowSize( const GeomDet* det, 
@@ -36,12 +36,28 @@ class TIBLayer final : public TBLayer {
 			   const TrajectoryStateOnSurface& tsos, 
 			   const MeasurementEstimator& est) const  override __attribute__ ((hot));
 
-  static bool overlap( const GlobalPoint& gpos, const GeometricSearchDet& ring, float window)   __attribute__ ((hot));
+  // z position and half length of a ring, cached at construction so that the
+  // hot path does not go through the surface and its bounds for every ring
+  struct RingZRange {
+    float z;
+    float halfLength;
+  };
+
+  static bool overlap( const GlobalPoint& gpos, const RingZRange& ring, float window)   __attribute__ ((hot));
+
+  const std::vector<RingZRange>& subLayerZRanges( int ind) const {
+    return (ind==0 ? theInnerZRanges : theOuterZRanges);
+  }
+
+  static std::vector<RingZRange> zRanges( const std::vector<const GeometricSearchDet*>& rings) __attribute__ ((cold));
 
 
   GeneralBinFinderInZforGeometricSearchDet<float> theInnerBinFinder;
   GeneralBinFinderInZforGeometricSearchDet<float> theOuterBinFinder;
 
+  std::vector<RingZRange> theInnerZRanges;
+  std::vector<RingZRange> theOuterZRanges;
+
   BoundCylinder* cylinder( const std::vector<const GeometricSearchDet*>& rings) __attribute__ ((cold));
 
 
@@ -11,7 +11,8 @@
 
 /** A RecHit container sorted in phi.
  *  Provides fast access for hits in a given phi window
- *  using binary search.
+ *  using a coarse phi-bin index followed by a binary search
+ *  limited to a few bins.
  */
 
 class RecHitsSortedInPhi {
@@ -117,6 +118,16 @@ public:
     for (HitIter i = range.first; i != range.second; i++) result.push_back( i->hit());
   }
 
+private:
+  // first hit of each of kPhiBins equal bins in [-pi,pi); the last entry is size()
+  static constexpr int kPhiBins = 128;
+  std::array<int,kPhiBins+1> thePhiBinBegin;
+
+  void buildPhiIndex();
+  HitIter lowerBoundPhi(float phi) const;
+  HitIter upperBoundPhi(float phi) const;
+  std::pair<int,int> phiSearchBins(float phi) const;
+
 };
 
 
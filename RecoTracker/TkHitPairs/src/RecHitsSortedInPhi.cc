@@ -44,7 +44,39 @@ RecHitsSortedInPhi::RecHitsSortedInPhi(const std::vector<Hit>& hits, GlobalPoint
     dv[i] = isBarrel ? dz : dr;
     lphi[i] = loc.barePhi();
   }
-  
+
+  buildPhiIndex();
+}
+
+void RecHitsSortedInPhi::buildPhiIndex() {
+  constexpr float binWidth = Geom::ftwoPi()/kPhiBins;
+  int n = theHits.size();
+  int i = 0;
+  for (int b=0; b!=kPhiBins; ++b) {
+    float edge = -Geom::fpi() + b*binWidth;
+    while (i!=n && theHits[i].phi() < edge) ++i;
+    thePhiBinBegin[b] = i;
+  }
+  thePhiBinBegin[kPhiBins] = n;
+}
+
+// Range of the index in which all hits with phi equal to the one given are found.
+// One bin of margin on each side absorbs rounding in the bin computation.
+std::pair<int,int> RecHitsSortedInPhi::phiSearchBins(float phi) const {
+  constexpr float invBinWidth = kPhiBins/Geom::ftwoPi();
+  int b = (phi + Geom::fpi())*invBinWidth;
+  b = std::min(std::max(b,0),kPhiBins-1);
+  return std::make_pair(thePhiBinBegin[std::max(b-1,0)], thePhiBinBegin[std::min(b+2,kPhiBins)]);
+}
+
+RecHitsSortedInPhi::HitIter RecHitsSortedInPhi::lowerBoundPhi(float phi) const {
+  auto bins = phiSearchBins(phi);
+  return std::lower_bound(theHits.begin()+bins.first, theHits.begin()+bins.second, HitWithPhi(phi), HitLessPhi());
+}
+
+RecHitsSortedInPhi::HitIter RecHitsSortedInPhi::upperBoundPhi(float phi) const {
+  auto bins = phiSearchBins(phi);
+  return std::upper_bound(theHits.begin()+bins.first, theHits.begin()+bins.second, HitWithPhi(phi), HitLessPhi());
 }
 
 
@@ -105,7 +137,6 @@ std::vector<RecHitsSortedInPhi::Hit> RecHitsSortedInPhi::hits( float phiMin, flo
 RecHitsSortedInPhi::Range 
 RecHitsSortedInPhi::unsafeRange( float phiMin, float phiMax) const
 {
-  auto low = std::lower_bound( theHits.begin(), theHits.end(), HitWithPhi(phiMin), HitLessPhi());
-  return Range( low,
-	       std::upper_bound(low, theHits.end(), HitWithPhi(phiMax), HitLessPhi()));
+  auto low = lowerBoundPhi(phiMin);
+  return Range( low, std::max(low, upperBoundPhi(phiMax)));
 }
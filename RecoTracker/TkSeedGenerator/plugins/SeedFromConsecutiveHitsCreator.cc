@@ -169,6 +169,7 @@ void SeedFromConsecutiveHitsCreator::buildSeed(
   
   TrajectoryStateOnSurface updatedState;
   edm::OwnVector<TrackingRecHit> seedHits;
+  seedHits.reserve(hits.size());
   
   const TrackingRecHit* hit = nullptr;
   for ( unsigned int iHit = 0; iHit < hits.size(); iHit++) {
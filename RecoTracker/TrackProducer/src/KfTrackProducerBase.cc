@@ -44,6 +44,10 @@ void KfTrackProducerBase::putInEvt(edm::Event& evt,
   selTracks->reserve(algoResults.size());
   selTrackExtras->reserve(algoResults.size());
   if(trajectoryInEvent_) selTrajectories->reserve(algoResults.size());
+  // every measurement gives at most one cloned hit, so size the hit collection once
+  size_t nMeasurements = 0;
+  for(auto const & result : algoResults) nMeasurements += result.trajectory->measurements().size();
+  selHits->reserve(selHits->size() + nMeasurements);
 
   for(AlgoProductCollection::iterator i=algoResults.begin(); i!=algoResults.end();i++){
     auto theTraj = (*i).trajectory;
@@ -316,6 +316,7 @@ AdaptiveVertexFitter::linearizeTracks(const vector<reco::TransientTrack> & track
 {
   const GlobalPoint & linP ( seed.position() );
   vector<RefCountedLinearizedTrackState> lTracks;
+  lTracks.reserve(tracks.size());
   for(vector<reco::TransientTrack>::const_iterator i = tracks.begin();
       i != tracks.end(); ++i )
   {
@@ -345,6 +346,7 @@ AdaptiveVertexFitter::reLinearizeTracks(
   const VertexState& seed = vertex.vertexState();
   GlobalPoint linP = seed.position();
   vector<RefCountedLinearizedTrackState> lTracks;
+  lTracks.reserve(tracks.size());
   for(vector<RefCountedVertexTrack>::const_iterator i = tracks.begin();
     i != tracks.end(); i++)
   {
@@ -400,6 +402,7 @@ AdaptiveVertexFitter::reWeightTracks(
   // GlobalPoint pos = seed.position();
 
   vector<RefCountedVertexTrack> finalTracks;
+  finalTracks.reserve(lTracks.size());
   VertexTrackFactory<5> vTrackFactory;
   #ifdef STORE_WEIGHTS
   iter++;
@@ -455,6 +458,7 @@ AdaptiveVertexFitter::weightTracks(
   theAssProbComputer->resetAnnealing();
 
   vector<RefCountedVertexTrack> finalTracks;
+  finalTracks.reserve(lTracks.size());
   VertexTrackFactory<5> vTrackFactory;
   #ifdef STORE_WEIGHTS
   iter++;
@@ -500,6 +504,7 @@ AdaptiveVertexFitter::reWeightTracks(
                             const CachingVertex<5> & seed) const
 {
   vector<RefCountedLinearizedTrackState> lTracks;
+  lTracks.reserve(tracks.size());
   for(vector<RefCountedVertexTrack>::const_iterator i = tracks.begin();
     i != tracks.end(); i++)
   {
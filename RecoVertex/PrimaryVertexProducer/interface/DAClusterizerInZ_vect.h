@@ -98,6 +98,20 @@ public:
       ExtractRaw();
     }
     
+    // preallocate room for n prototypes, so that splitting does not reallocate
+    void Reserve( unsigned int n )
+    {
+      z.reserve(n);
+      pk.reserve(n);
+      
+      ei_cache.reserve(n);
+      ei.reserve(n);
+      sw.reserve(n);
+      swz.reserve(n);
+      se.reserve(n);
+      swE.reserve(n);
+    }
+    
     void InsertItem( unsigned int i, double new_z, double new_pk   )
     {
       z.insert(z.begin() + i, new_z);
@@ -7,6 +7,7 @@
 #include <cassert>
 #include <limits>
 #include <iomanip>
+#include <algorithm>
 #include "FWCore/Utilities/interface/isFinite.h"
 #include "vdt/vdtMath.h"
 
@@ -449,6 +450,12 @@ DAClusterizerInZ_vect::split(const double beta,  track_t &tks, vertex_t & y, dou
   bool split=false;
   const unsigned int nt = tks.GetSize();
 
+  // the softening scale of each track does not depend on the vertex
+  std::vector<double> sqrtBetaDz2(nt);
+  for(unsigned int i=0; i<nt; i++){
+    sqrtBetaDz2[i] = sqrt(beta * tks._dz2[i]);
+  }
+
   for(unsigned int ic=0; ic<critical.size(); ic++){
     unsigned int k=critical[ic].second;
 
@@ -463,7 +470,7 @@ DAClusterizerInZ_vect::split(const double beta,  track_t &tks, vertex_t & y, dou
 	double tr = 1. - tl;
 
 	 // soften it, especially at low T
-	double arg = (tks._z[i] - y._z[k]) * sqrt(beta * tks._dz2[i]);
+	double arg = (tks._z[i] - y._z[k]) * sqrtBetaDz2[i];
 	if(std::fabs(arg) < 20){
 	  double t = local_exp(-arg);
 	  tl = t/(t+1.);
@@ -584,6 +591,9 @@ DAClusterizerInZ_vect::vertices(const vector<reco::TransientTrack> & tracks, con
   if (tks.GetSize() == 0) return clusters;
   
   vertex_t y; // the vertex prototypes
+  // the number of prototypes stays well below the number of tracks: reserve
+  // enough for typical pile-up and let the rare larger events grow the arrays
+  y.Reserve(std::min(nt, 256u));
   
   // initialize:single vertex at infinite temperature
   y.AddItem( 0, 1.0);
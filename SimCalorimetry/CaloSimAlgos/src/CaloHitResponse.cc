@@ -80,12 +80,9 @@ void CaloHitResponse::add( const PCaloHit& hit, CLHEP::HepRandomEngine* engine )
     if( !keep )
     {
        const unsigned int size ( signal.size() ) ;
-       if( 0 != size )
+       for( unsigned int i ( 0 ) ; i != size && !keep ; ++i )
        {
-	  for( unsigned int i ( 0 ) ; i != size ; ++i )
-	  {
-	     keep = keep || signal[i] > 1.e-7 ;
-	  }
+	  keep = signal[i] > 1.e-7 ;
        }
     }
 
@@ -96,13 +93,10 @@ void CaloHitResponse::add( const PCaloHit& hit, CLHEP::HepRandomEngine* engine )
 
 void CaloHitResponse::add(const CaloSamples & signal)
 {
-  DetId id(signal.id());
-  CaloSamples * oldSignal = findSignal(id);
-  if (oldSignal == nullptr) {
-    theAnalogSignalMap[id] = signal;
-
-  } else  {
-    (*oldSignal) += signal;
+  // a single map lookup, which copies the signal only for a new DetId
+  auto inserted = theAnalogSignalMap.try_emplace(DetId(signal.id()), signal);
+  if (!inserted.second) {
+    inserted.first->second += signal;
   }
 }
 
@@ -65,12 +65,17 @@ void HGCDigitizerBase<DFr>::runSimple(std::unique_ptr<HGCDigitizerBase::DColl> &
     HGCCellInfo& cell = ( simData.end() == it ? zeroData : it->second );
     addCellMetadata(cell,theGeom,id);
 
+    //the noise width only depends on the cell
+    const bool addNoise(noise_fC_[cell.thickness-1] != 0);
+    const double noiseWidth(cell.size*noise_fC_[cell.thickness-1]);
+    const bool weightToAByE(myFEelectronics_->toaMode()==HGCFEElectronics<DFr>::WEIGHTEDBYE);
+
     for(size_t i=0; i<cell.hit_info[0].size(); i++) {
       double rawCharge(cell.hit_info[0][i]);
 
       //time of arrival
       toa[i]=cell.hit_info[1][i];
-      if(myFEelectronics_->toaMode()==HGCFEElectronics<DFr>::WEIGHTEDBYE && rawCharge>0)
+      if(weightToAByE && rawCharge>0)
         toa[i]=cell.hit_info[1][i]/rawCharge;
 
       //convert total energy in GeV to charge (fC)
@@ -80,8 +85,8 @@ void HGCDigitizerBase<DFr>::runSimple(std::unique_ptr<HGCDigitizerBase::DColl> &
       //add noise (in fC)
       //we assume it's randomly distributed and won't impact ToA measurement
       //also assume that it is related to the charge path only and that noise fluctuation for ToA circuit be handled separately
-      if (noise_fC_[cell.thickness-1] != 0)
-        totalCharge += std::max( (float)CLHEP::RandGaussQ::shoot(engine,0.0,cell.size*noise_fC_[cell.thickness-1]) , 0.f );
+      if (addNoise)
+        totalCharge += std::max( (float)CLHEP::RandGaussQ::shoot(engine,0.0,noiseWidth) , 0.f );
       if(totalCharge<0.f) totalCharge=0.f;
 
       chargeColl[i]= totalCharge;
@@ -153,10 +153,11 @@ void HGCFEElectronics<DFr>::runSimpleShaper(DFr &dataFrame, HGCSimHitData& charg
 
       if(debug) edm::LogVerbatim("HGCFE") << "\t Redistributing SARS ADC" << charge << " @ " << it;
       
-      for(int ipulse=-2; ipulse<(int)(adcPulse_.size())-2; ipulse++)
+      //only the part of the pulse falling inside the data frame is accumulated
+      const int start = std::max(-2,-it);
+      const int stop  = std::min((int)(adcPulse_.size())-2,(int)(dataFrame.size())-it);
+      for(int ipulse=start; ipulse<stop; ipulse++)
 	{
-	  if(it+ipulse<0) continue;
-	  if(it+ipulse>=(int)(dataFrame.size())) continue;
           const float chargeLeak=charge*adcPulse_[(ipulse+2)];
 	  newCharge[it+ipulse]+= chargeLeak;
 	  
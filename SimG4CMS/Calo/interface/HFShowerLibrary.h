@@ -80,6 +80,7 @@ private:
   HFShowerPhotonCollection pe;
   HFShowerPhotonCollection* photo;
   HFShowerPhotonCollection photon;
+  std::vector<float>  photonColumns;  // v3 record buffer, re-used between records
 
 };
 #endif
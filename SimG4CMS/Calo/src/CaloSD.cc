@@ -378,10 +378,11 @@ CaloG4Hit* CaloSD::createNewHit(const G4Step* aStep) {
   
   CaloG4Hit* aHit;
   if (!reusehit.empty()) {
-    aHit = reusehit[0];
+    // take from the back: every field is reset below, so the order is free
+    aHit = reusehit.back();
     aHit->setEM(0.f);
     aHit->setHadr(0.f);
-    reusehit.erase(reusehit.begin());
+    reusehit.pop_back();
   } else {
     aHit = new CaloG4Hit;
   }
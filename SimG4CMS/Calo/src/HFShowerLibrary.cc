@@ -377,14 +377,14 @@ void HFShowerLibrary::getRecord(int type, int record) {
         hadBranch->GetEntry(nrc+totEvents);
       }
       else{
-        std::vector<float> t;
-        std::vector<float> *tp=&t;
+        std::vector<float> *tp=&photonColumns;
         hadBranch->SetAddress(&tp);
         hadBranch->GetEntry(nrc+totEvents);
+        const std::vector<float>& t = photonColumns;
         unsigned int tSize=t.size()/5;
         photo->reserve(tSize);
         for ( unsigned int i=0; i<tSize; i++ ) {
-          photo->push_back( HFShowerPhoton( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] ) );
+          photo->emplace_back( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] );
         }
       }
     } else {
@@ -398,14 +398,14 @@ void HFShowerLibrary::getRecord(int type, int record) {
         emBranch->GetEntry(nrc);
       }
       else{
-        std::vector<float> t;
-        std::vector<float> *tp=&t;
+        std::vector<float> *tp=&photonColumns;
         emBranch->SetAddress(&tp);
         emBranch->GetEntry(nrc);
+        const std::vector<float>& t = photonColumns;
         unsigned int tSize=t.size()/5;
         photo->reserve(tSize);
         for ( unsigned int i=0; i<tSize; i++ ) {
-          photo->push_back( HFShowerPhoton( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] ) );
+          photo->emplace_back( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] );
         }
       }
     } else {
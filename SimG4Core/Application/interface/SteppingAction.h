@@ -43,10 +43,14 @@ private:
   bool initPointer();
 
   bool isInsideDeadRegion(const G4Region* reg) const;
-  bool isOutOfTimeWindow(G4Track* theTrack, const G4Region* reg) const;
+  double maxTimeInRegion(const G4Region* reg) const;
   bool isThisVolume(const G4VTouchable* touch, const G4VPhysicalVolume* pv) const;
+  bool isEkinVolume(const G4LogicalVolume* lv) const;
 
-  bool isLowEnergy(const G4Step * aStep) const;
+  // consecutive steps mostly stay in the same region and volume, so
+  // the vector lookups are only redone when the pointer changes
+  void setCurrentRegion(const G4Region* reg);
+  bool isLowEnergy(const G4Step * aStep);
   void PrintKilledTrack(const G4Track*, const TrackStatus&) const;
 
   EventAction                   *eventAction_;
@@ -62,12 +66,17 @@ private:
   std::vector<const G4Region*>  deadRegions;
   std::vector<G4LogicalVolume*> ekinVolumes;
   std::vector<int>              ekinPDG;
+  const G4Region*               currentRegion;
+  double                        currentMaxTime;
+  const G4LogicalVolume*        currentEkinVolume;
   unsigned int                  numberTimes;
   unsigned int                  numberEkins;
   unsigned int                  numberPart;
   unsigned int                  ndeadRegions;
   unsigned int                  nWarnings;
 
+  bool                          currentDead;
+  bool                          currentEkinFlag;
   bool                          initialized;
   bool                          killBeamPipe;
   bool                          hasWatcher;
@@ -85,8 +94,7 @@ inline bool SteppingAction::isInsideDeadRegion(const G4Region* reg) const
   return res;
 }
 
-inline bool 
-SteppingAction::isOutOfTimeWindow(G4Track* theTrack, const G4Region* reg) const
+inline double SteppingAction::maxTimeInRegion(const G4Region* reg) const
 {
   double tofM = maxTrackTime;
   for (unsigned int i=0; i<numberTimes; ++i) {
@@ -95,7 +103,26 @@ SteppingAction::isOutOfTimeWindow(G4Track* theTrack, const G4Region* reg) const
       break;
     }
   }
-  return (theTrack->GetGlobalTime() > tofM) ? true : false;
+  return tofM;
+}
+
+inline bool SteppingAction::isEkinVolume(const G4LogicalVolume* lv) const
+{
+  bool res = false;
+  for (unsigned int i=0; i<numberEkins; ++i) {
+    if (lv == ekinVolumes[i]) {
+      res = true;
+      break;
+    }
+  }
+  return res;
+}
+
+inline void SteppingAction::setCurrentRegion(const G4Region* reg)
+{
+  currentRegion  = reg;
+  currentDead    = isInsideDeadRegion(reg);
+  currentMaxTime = maxTimeInRegion(reg);
 }
 
 inline bool SteppingAction::isThisVolume(const G4VTouchable* touch, 
@@ -18,7 +18,9 @@
 SteppingAction::SteppingAction(EventAction* e, const edm::ParameterSet & p,
 			       const CMSSteppingVerbose* sv, bool hasW) 
   : eventAction_(e), tracker(nullptr), calo(nullptr), steppingVerbose(sv),
-    nWarnings(0),initialized(false), killBeamPipe(false),hasWatcher(hasW)
+    currentRegion(nullptr), currentMaxTime(0.0), currentEkinVolume(nullptr),
+    nWarnings(0), currentDead(false), currentEkinFlag(false),
+    initialized(false), killBeamPipe(false),hasWatcher(hasW)
 {
   theCriticalEnergyForVacuum = 
     (p.getParameter<double>("CriticalEnergyForVacuum")*CLHEP::MeV);
@@ -101,8 +103,10 @@ void SteppingAction::UserSteppingAction(const G4Step * aStep)
     const G4Region* theRegion = 
       preStep->GetPhysicalVolume()->GetLogicalVolume()->GetRegion();
 
+    if(theRegion != currentRegion) { setCurrentRegion(theRegion); }
+
     // kill in dead regions
-    if(isInsideDeadRegion(theRegion)) { tstat = sDeadRegion; }
+    if(currentDead) { tstat = sDeadRegion; }
 
     // NaN energy deposit
     if(sAlive == tstat && edm::isNotFinite(aStep->GetTotalEnergyDeposit())) {
@@ -121,7 +125,7 @@ void SteppingAction::UserSteppingAction(const G4Step * aStep)
     }
 
     // kill out of time
-    if(sAlive == tstat && isOutOfTimeWindow(theTrack, theRegion)) { tstat = sOutOfTime; }
+    if(sAlive == tstat && theTrack->GetGlobalTime() > currentMaxTime) { tstat = sOutOfTime; }
 
     // kill low-energy in volumes on demand
     if(sAlive == tstat && numberEkins > 0 && isLowEnergy(aStep)) { tstat = sLowEnergy; }
@@ -167,18 +171,15 @@ void SteppingAction::UserSteppingAction(const G4Step * aStep)
   }
 }
 
-bool SteppingAction::isLowEnergy(const G4Step * aStep) const
+bool SteppingAction::isLowEnergy(const G4Step * aStep)
 {
-  bool flag = false;
   const G4StepPoint* sp = aStep->GetPostStepPoint(); 
-  G4LogicalVolume* lv = sp->GetPhysicalVolume()->GetLogicalVolume();
-  for (unsigned int i=0; i<numberEkins; ++i) {
-    if (lv == ekinVolumes[i]) {
-      flag = true;
-      break;
-    }
+  const G4LogicalVolume* lv = sp->GetPhysicalVolume()->GetLogicalVolume();
+  if (lv != currentEkinVolume) {
+    currentEkinVolume = lv;
+    currentEkinFlag   = isEkinVolume(lv);
   }
-  if (flag) {
+  if (currentEkinFlag) {
     double    ekin  = sp->GetKineticEnergy();
     int       pCode = aStep->GetTrack()->GetDefinition()->GetPDGEncoding();
     for (unsigned int i=0; i<numberPart; ++i) {
@@ -268,6 +269,10 @@ bool SteppingAction::initPointer()
       }
     }
   }
+  // prime the caches with the lookups for a null pointer, so the first
+  // step sees exactly what the vector searches would have returned
+  setCurrentRegion(nullptr);
+  currentEkinFlag = isEkinVolume(nullptr);
   return true;
 }
 
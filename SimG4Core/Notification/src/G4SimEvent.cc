@@ -39,6 +39,7 @@ G4SimEvent::~G4SimEvent()
 
 void G4SimEvent::load(edm::SimTrackContainer & c) const
 {
+    c.reserve(c.size()+g4tracks.size());
     for (unsigned int i=0; i<g4tracks.size(); i++)
     {
 	G4SimTrack * trk    = g4tracks[i];
@@ -72,6 +73,7 @@ void G4SimEvent::load(edm::SimTrackContainer & c) const
 
 void G4SimEvent::load(edm::SimVertexContainer & c) const
 {
+    c.reserve(c.size()+g4vertices.size());
     for (unsigned int i=0; i<g4vertices.size(); i++)
     {
 	G4SimVertex * vtx   = g4vertices[i];
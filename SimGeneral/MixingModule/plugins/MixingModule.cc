@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <memory>
+#include <numeric>
 
 #include "MixingModule.h"
 #include "MixingWorker.h"
@@ -353,7 +354,7 @@ namespace edm {
   void MixingModule::doPileUp(edm::Event &e, const edm::EventSetup& setup) {
     using namespace std::placeholders;
 
-    // Don't allocate because PileUp will do it for us.
+    // PileUp::readPileUp only reserves for one bunch crossing, the full size is reserved below.
     std::vector<edm::SecondaryEventIDAndFileInfo> recordEventID;
     std::vector<size_t> sizes;
     sizes.reserve(maxNbSources_*(maxBunch_ + 1 - minBunch_));
@@ -392,6 +393,12 @@ namespace edm {
 
     }
 
+    if(!playback_) {
+      // all bunch crossings append to recordEventID: one event per crossing for the other sources
+      recordEventID.reserve(std::accumulate(PileupList.begin(), PileupList.end(), size_t(0))
+                            + (maxNbSources_ - 1)*(maxBunch_ + 1 - minBunch_));
+    }
+
     // pre-populate Pileup information
     // necessary for luminosity-dependent effects during hit accumulation
 
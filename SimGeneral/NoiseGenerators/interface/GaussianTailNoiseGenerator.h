@@ -59,8 +59,14 @@ protected:
 
 private:
 
+  // Gaussian tail probability above threshold, cached for the last threshold
+  double tailProbability(float threshold);
+
   int channel512_[512];
   int channel768_[768];
+  float lastThreshold_;
+  double lastTailProbability_;
+  bool tailProbabilityValid_;
 };
 
 #endif
@@ -8,7 +8,8 @@
 #include <gsl/gsl_sf_erf.h>
 #include <gsl/gsl_sf_result.h>
 
-GaussianTailNoiseGenerator::GaussianTailNoiseGenerator() {
+GaussianTailNoiseGenerator::GaussianTailNoiseGenerator() :
+  lastThreshold_(0.f), lastTailProbability_(0.), tailProbabilityValid_(false) {
   // we have two cases: 512 and 768 channels
   // other cases are not allowed so far (performances issue)
   for(unsigned int i=0;i<512;++i) channel512_[i]=i;
@@ -23,12 +24,7 @@ void GaussianTailNoiseGenerator::generate(int NumberOfchannels,
                                           CLHEP::HepRandomEngine* engine ) {
 
    // Gaussian tail probability
-  gsl_sf_result result;
-  int status = gsl_sf_erf_Q_e(threshold, &result);
-
-  if (status != 0) std::cerr<<"GaussianTailNoiseGenerator::could not compute gaussian tail probability for the threshold chosen"<<std::endl;
-
-  float probabilityLeft = result.val;  
+  float probabilityLeft = tailProbability(threshold);
   float meanNumberOfNoisyChannels = probabilityLeft * NumberOfchannels;
 
   CLHEP::RandPoissonQ randPoissonQ(*engine, meanNumberOfNoisyChannels);
@@ -57,10 +53,7 @@ void GaussianTailNoiseGenerator::generate(int NumberOfchannels,
                                           CLHEP::HepRandomEngine* engine ) {
   // Compute number of channels with noise above threshold
   // Gaussian tail probability
-  gsl_sf_result result;
-  int status = gsl_sf_erf_Q_e(threshold, &result);
-  if (status != 0) std::cerr<<"GaussianTailNoiseGenerator::could not compute gaussian tail probability for the threshold chosen"<<std::endl;
-  double probabilityLeft = result.val;  
+  double probabilityLeft = tailProbability(threshold);
   double meanNumberOfNoisyChannels = probabilityLeft * NumberOfchannels;
 
   CLHEP::RandPoissonQ randPoissonQ(*engine, meanNumberOfNoisyChannels);
@@ -112,6 +105,22 @@ void GaussianTailNoiseGenerator::generateRaw(float noiseRMS,
   }
 }
 
+double
+GaussianTailNoiseGenerator::tailProbability(float threshold) {
+  // the threshold is the same for all modules of a digitizer in practice
+  if(tailProbabilityValid_ && threshold == lastThreshold_) return lastTailProbability_;
+  gsl_sf_result result;
+  int status = gsl_sf_erf_Q_e(threshold, &result);
+  if (status != 0) {
+    std::cerr<<"GaussianTailNoiseGenerator::could not compute gaussian tail probability for the threshold chosen"<<std::endl;
+    return result.val;
+  }
+  lastThreshold_ = threshold;
+  lastTailProbability_ = result.val;
+  tailProbabilityValid_ = true;
+  return lastTailProbability_;
+}
+
 int*
 GaussianTailNoiseGenerator::getRandomChannels(int numberOfNoisyChannels, int numberOfchannels, CLHEP::HepRandomEngine* engine) {
   if(numberOfNoisyChannels>numberOfchannels) numberOfNoisyChannels = numberOfchannels;
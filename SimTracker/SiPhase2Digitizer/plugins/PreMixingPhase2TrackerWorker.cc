@@ -84,13 +84,19 @@ void PreMixingPhase2TrackerWorker::addPileups(PileUpEventPrincipal const& pep, e
 }
 
 void PreMixingPhase2TrackerWorker::accumulate(const edm::DetSetVector<PixelDigi>& digis) {
+  // DetSets come sorted by DetId (and digis usually by channel), so the
+  // position after the previous element is an exact hint for the next one
+  auto detHint = accumulator_.begin();
   for(const auto& detset: digis) {
-    auto& accDet = accumulator_[detset.detId()];
+    detHint = accumulator_.try_emplace(detHint, detset.detId());
+    auto& accDet = detHint->second;
+    ++detHint;
+    auto chHint = accDet.begin();
     for(const auto& digi: detset) {
-      // note: according to C++ standard operator[] does
-      // value-initializiation, which for float means initial value of 0
-      auto& acc = accDet[digi.channel()];
-      acc += digi.adc()*electronPerAdc_;
+      // note: try_emplace value-initializes a new entry, which for float means initial value of 0
+      chHint = accDet.try_emplace(chHint, digi.channel());
+      chHint->second += digi.adc()*electronPerAdc_;
+      ++chHint;
     }
   }
 }
@@ -175,6 +175,8 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
     AssociationInfoForChannel* pDetIDAssociationInfo; // I only need this if makeDigiSimLinks_ is true...
     if( makeDigiSimLinks_ ) pDetIDAssociationInfo=&(associationInfoForDetId_[detId]); // ...so only search the map if that is the case
     std::vector<float> previousLocalAmplitude; // Only used if makeDigiSimLinks_ is true. Needed to work out the change in amplitude.
+    // Copied once, then kept equal to locAmpl by updating only the strips each SimHit touches.
+    if( makeDigiSimLinks_ ) previousLocalAmplitude=locAmpl;
 
     size_t simHitGlobalIndex=inputBeginGlobalIndex; // This needs to stored to create the digi-sim link later
     for (std::vector<PSimHit>::const_iterator simHitIter = inputBegin; simHitIter != inputEnd; ++simHitIter, ++simHitGlobalIndex ) {
@@ -184,7 +186,6 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
       }
       // check TOF
       if (std::fabs(simHitIter->tof() - cosmicShift - det->surface().toGlobal(simHitIter->localPosition()).mag()/30.) < tofCut && simHitIter->energyLoss()>0) {
-        if( makeDigiSimLinks_ ) previousLocalAmplitude=locAmpl; // Not needed except to make the sim link association.
         size_t localFirstChannel = numStrips;
         size_t localLastChannel  = 0;
         // process the hit
@@ -194,9 +195,11 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
         if(thisLastChannelWithSignal < localLastChannel) thisLastChannelWithSignal = localLastChannel;
 
         if( makeDigiSimLinks_ ) { // No need to do any of this if truth association was turned off in the configuration
-          for( size_t stripIndex=0; stripIndex<locAmpl.size(); ++stripIndex ) {
+          // processHit only touches strips in [localFirstChannel, localLastChannel)
+          for( size_t stripIndex=localFirstChannel; stripIndex<localLastChannel; ++stripIndex ) {
             // Work out the amplitude from this SimHit from the difference of what it was before and what it is now
             float signalFromThisSimHit=locAmpl[stripIndex]-previousLocalAmplitude[stripIndex];
+            previousLocalAmplitude[stripIndex]=locAmpl[stripIndex];
             if( signalFromThisSimHit!=0 ) { // If this SimHit had any contribution I need to record it.
               auto& associationVector=(*pDetIDAssociationInfo)[stripIndex];
               bool addNewEntry=true;
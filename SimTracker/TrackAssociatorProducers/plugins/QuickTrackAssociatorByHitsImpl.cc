@@ -351,7 +351,7 @@ template<typename T_TPCollection,typename iter> std::vector< std::pair<edm::Ref<
 			for( auto ip=range.first; ip != range.second; ++ip )
 			{
 
-				const TrackingParticleRef trackingParticle=(ip->second);
+				const TrackingParticleRef& trackingParticle=(ip->second);
 
                                 if(trackingParticleKeys && !trackingParticleKeys->has(trackingParticle.key()))
                                   continue;
@@ -376,13 +376,14 @@ template<typename T_TPCollection,typename iter> std::vector< std::pair<edm::Ref<
 				 std::sort(returnValue.begin(), returnValue.end(), tpIntPairGreater);
 				 }
 				 */
-				auto jpos=lmap.find( trackingParticle );
-				if( jpos != lmap.end() ) jpos->second += weight;
-				else lmap.insert( std::make_pair( trackingParticle, weight ) );
+				auto jpos=lmap.lower_bound( trackingParticle );
+				if( jpos != lmap.end() && !lmap.key_comp()( trackingParticle, jpos->first ) ) jpos->second += weight;
+				else lmap.emplace_hint( jpos, trackingParticle, weight );
 			}
 		}
 	}
 	// now copy the map to returnValue
+	returnValue.reserve( lmap.size() );
 	for( auto ip=lmap.begin(); ip != lmap.end(); ++ip )
 	{
 		returnValue.push_back( std::make_pair( ip->first, ip->second ) );
@@ -527,7 +528,7 @@ template<typename iter> double QuickTrackAssociatorByHitsImpl::getDoubleCount( c
 			{
 				for( auto ip=range.first; ip != range.second; ++ip )
 				{
-					const TrackingParticleRef trackingParticle=(ip->second);
+					const TrackingParticleRef& trackingParticle=(ip->second);
 					if( associatedTrackingParticle == trackingParticle )
 					{
 						idcount++;
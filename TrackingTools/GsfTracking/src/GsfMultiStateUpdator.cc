@@ -27,14 +27,16 @@ TrajectoryStateOnSurface GsfMultiStateUpdator::update(const TrajectoryStateOnSur
 
   MultiTrajectoryStateAssembler result;
 
+  const KFUpdator kfUpdator;
+  const MagneticField* field = &(tsos.globalParameters().magneticField());
   int i = 0;
   for (auto const & tsosI : predictedComponents) {
-    TrajectoryStateOnSurface updatedTSOS = KFUpdator().update(tsosI, aRecHit);
+    TrajectoryStateOnSurface updatedTSOS = kfUpdator.update(tsosI, aRecHit);
     if (updatedTSOS.isValid()){
       result.addState(TrajectoryStateOnSurface(weights[i], 
                                                updatedTSOS.localParameters(),
 					       updatedTSOS.localError(), updatedTSOS.surface(), 
-					       &(tsos.globalParameters().magneticField()),
+					       field,
 					       tsosI.surfaceSide()
                                               ));
     }
@@ -87,9 +87,9 @@ TrajectoryStateOnSurface lupdate(const TrajectoryStateOnSurface& tsos,
   SMatDD R = V + VMeas;
   bool ok = invertPosDefMatrix(R);
 
-  // Compute Kalman gain matrix
+  // Compute Kalman gain matrix: K = (C*H^T)*R, without the 5x5 product
   AlgebraicMatrix55 M = AlgebraicMatrixID();
-  Mat5D K = C*pf.project(R);
+  Mat5D K = pf.rproject(C)*R;
   pf.projectAndSubtractFrom(M,K);
  
 
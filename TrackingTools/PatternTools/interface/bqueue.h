@@ -2,6 +2,8 @@
 #define CMSUTILS_BEUEUE_H
 #include <boost/intrusive_ptr.hpp>
 #include<cassert>
+#include<cstddef>
+#include<new>
 
 /**  Backwards linked queue with "head sharing"
 
@@ -31,6 +33,9 @@
     to support c++11 begin,end and operator++ has been added with the same semantics of rbegin,rend and operator--
     Highly confusing, still the bqueue is a sort of reversed slist: provided the user knows should work....
 
+    Items are allocated from a small per-thread cache of released items (see _bqueue_item_cache):
+    trajectory building creates and drops hundreds of thousands of them per event, all of the same size.
+
 
 */
 namespace cmsutils {
@@ -41,6 +46,62 @@ namespace cmsutils {
   template<class T> void intrusive_ptr_add_ref(_bqueue_item<T> *it) ;
   template<class T> void intrusive_ptr_release(_bqueue_item<T> *it) ;
   
+  // Per-thread free list of released items of a given size, bounded to maxSize entries.
+  // The list head lives in a trivially destructible thread_local, so releasing
+  // an item during thread (or program) shutdown stays safe: once the thread's
+  // guard has drained the list, items go straight back to the global heap.
+  template<std::size_t S>
+  class _bqueue_item_cache {
+  public:
+    static void * allocate() {
+      auto & c = cache();
+      if (c.head) {
+        auto p = c.head;
+        c.head = p->next;
+        --c.size;
+        return p;
+      }
+      if (!c.disabled) guard();
+      return ::operator new(S);
+    }
+
+    static void release(void * p) {
+      auto & c = cache();
+      if (c.disabled || c.size >= maxSize) { ::operator delete(p); return; }
+      // a thread may only ever release items allocated elsewhere
+      if (!c.head) guard();
+      auto n = static_cast<node*>(p);
+      n->next = c.head;
+      c.head = n;
+      ++c.size;
+    }
+
+  private:
+    static constexpr unsigned int maxSize = 4096;
+
+    struct node { node * next; };
+    static_assert(S >= sizeof(node), "bqueue item too small for the free list");
+
+    struct list {
+      node * head;
+      unsigned int size;
+      bool disabled;
+    };
+
+    struct drain {
+      ~drain() {
+        auto & c = cache();
+        c.disabled = true;
+        while (c.head) { auto n = c.head->next; ::operator delete(c.head); c.head = n; }
+        c.size = 0;
+      }
+    };
+
+    static list & cache() { static thread_local list c{nullptr,0,false}; return c; }
+    // instantiated on first use of the list so that it is drained at thread exit
+    static void guard() { static thread_local drain d; (void)d; }
+  };
+
   template <class T> 
   class _bqueue_item  {
     friend class bqueue<T>;
@@ -49,6 +110,12 @@ namespace cmsutils {
     friend void intrusive_ptr_release<T>(_bqueue_item<T> *it);
     void addRef() { ++refCount; }
     void delRef() { if ((--refCount) == 0) delete this; }
+
+    static void * operator new(std::size_t) {
+      static_assert(alignof(_bqueue_item) <= alignof(std::max_align_t), "over-aligned bqueue item");
+      return _bqueue_item_cache<sizeof(_bqueue_item)>::allocate();
+    }
+    static void operator delete(void * p) { _bqueue_item_cache<sizeof(_bqueue_item)>::release(p); }
   private:
     _bqueue_item() : back(0), value(), refCount(0) { }
     _bqueue_item(boost::intrusive_ptr< _bqueue_item<T> > tail, const T &val) : back(tail), value(val), refCount(0) { }
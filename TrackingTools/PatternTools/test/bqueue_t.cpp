@@ -90,6 +90,29 @@ int main() {
   verifySeq(cont);
   assert(cont.begin()==cont.end());
 
+  // released items are recycled by the next ones
+  for (int k=0; k<3; ++k) {
+    Cont r;
+    for (int i=0; i<10000; ++i) r.emplace_back(new int(i));
+    verifySeq(r);
+    Cont f(r);
+    r.pop_back();
+    f.emplace_back(new int(10000));
+    verifySeq(f,0);
+  }
+
+  // and the last one released is the first one handed out again
+  {
+    Cont r;
+    r.emplace_back(new int(0));
+    r.emplace_back(new int(1));
+    auto released = &r.back();
+    r.pop_back();
+    r.emplace_back(new int(2));
+    assert(&r.back()==released);
+    assert((*r.back())==2);
+  }
+
   return cont.size();
 
 }
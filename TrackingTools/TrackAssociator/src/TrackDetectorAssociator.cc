@@ -275,6 +275,7 @@ void TrackDetectorAssociator::fillEcal( const edm::Event& iEvent,
      ", " << itr->position().z() << ", " << itr->position().phi();
 
    std::vector<GlobalPoint> coreTrajectory;
+   coreTrajectory.reserve(trajectoryStates.size());
    for(std::vector<SteppingHelixStateInfo>::const_iterator itr = trajectoryStates.begin();
        itr != trajectoryStates.end(); itr++) coreTrajectory.push_back(itr->position());
    
@@ -314,10 +315,12 @@ void TrackDetectorAssociator::fillEcal( const edm::Event& iEvent,
    for(std::vector<DetId>::const_iterator itr=crossedEcalIds.begin(); itr!=crossedEcalIds.end();itr++)
    {
       std::vector<EcalRecHit>::const_iterator ebHit = (*EBRecHits).find(*itr);
-      std::vector<EcalRecHit>::const_iterator eeHit = (*EERecHits).find(*itr);
-      if(ebHit != (*EBRecHits).end()) 
+      if(ebHit != (*EBRecHits).end()) {
          info.crossedEcalRecHits.push_back(&*ebHit);
-      else if(eeHit != (*EERecHits).end()) 
+         continue;
+      }
+      std::vector<EcalRecHit>::const_iterator eeHit = (*EERecHits).find(*itr);
+      if(eeHit != (*EERecHits).end()) 
          info.crossedEcalRecHits.push_back(&*eeHit);
       else  
          LogTrace("TrackAssociator") << "Crossed EcalRecHit is not found for DetId: " << itr->rawId();
@@ -325,10 +328,12 @@ void TrackDetectorAssociator::fillEcal( const edm::Event& iEvent,
    for(std::set<DetId>::const_iterator itr=ecalIdsInRegion.begin(); itr!=ecalIdsInRegion.end();itr++)
    {
       std::vector<EcalRecHit>::const_iterator ebHit = (*EBRecHits).find(*itr);
-      std::vector<EcalRecHit>::const_iterator eeHit = (*EERecHits).find(*itr);
-      if(ebHit != (*EBRecHits).end()) 
+      if(ebHit != (*EBRecHits).end()) {
          info.ecalRecHits.push_back(&*ebHit);
-      else if(eeHit != (*EERecHits).end()) 
+         continue;
+      }
+      std::vector<EcalRecHit>::const_iterator eeHit = (*EERecHits).find(*itr);
+      if(eeHit != (*EERecHits).end()) 
          info.ecalRecHits.push_back(&*eeHit);
       else 
          LogTrace("TrackAssociator") << "EcalRecHit from the cone is not found for DetId: " << itr->rawId();
@@ -343,6 +348,7 @@ void TrackDetectorAssociator::fillCaloTowers( const edm::Event& iEvent,
    std::vector<GlobalPoint> trajectory;
    const std::vector<SteppingHelixStateInfo>& ecalTrajectoryStates = cachedTrajectory_.getEcalTrajectory();
    const std::vector<SteppingHelixStateInfo>& hcalTrajectoryStates = cachedTrajectory_.getHcalTrajectory();
+   trajectory.reserve(ecalTrajectoryStates.size() + hcalTrajectoryStates.size());
    for(std::vector<SteppingHelixStateInfo>::const_iterator itr = ecalTrajectoryStates.begin();
        itr != ecalTrajectoryStates.end(); itr++) trajectory.push_back(itr->position());
    for(std::vector<SteppingHelixStateInfo>::const_iterator itr = hcalTrajectoryStates.begin();
@@ -411,6 +417,7 @@ void TrackDetectorAssociator::fillPreshower( const edm::Event& iEvent,
 {
    std::vector<GlobalPoint> trajectory;
    const std::vector<SteppingHelixStateInfo>& trajectoryStates = cachedTrajectory_.getPreshowerTrajectory();
+   trajectory.reserve(trajectoryStates.size());
    for(std::vector<SteppingHelixStateInfo>::const_iterator itr = trajectoryStates.begin();
        itr != trajectoryStates.end(); itr++) trajectory.push_back(itr->position());
    
@@ -436,6 +443,7 @@ void TrackDetectorAssociator::fillHcal( const edm::Event& iEvent,
    const std::vector<SteppingHelixStateInfo>& trajectoryStates = cachedTrajectory_.getHcalTrajectory();
 
    std::vector<GlobalPoint> coreTrajectory;
+   coreTrajectory.reserve(trajectoryStates.size());
    for(std::vector<SteppingHelixStateInfo>::const_iterator itr = trajectoryStates.begin();
        itr != trajectoryStates.end(); itr++) coreTrajectory.push_back(itr->position());   
    
@@ -501,6 +509,7 @@ void TrackDetectorAssociator::fillHO( const edm::Event& iEvent,
    const std::vector<SteppingHelixStateInfo>& trajectoryStates = cachedTrajectory_.getHOTrajectory();
 
    std::vector<GlobalPoint> coreTrajectory;
+   coreTrajectory.reserve(trajectoryStates.size());
    for(std::vector<SteppingHelixStateInfo>::const_iterator itr = trajectoryStates.begin();
        itr != trajectoryStates.end(); itr++) coreTrajectory.push_back(itr->position());
 
@@ -43,6 +43,7 @@ public:
   virtual IOSize	read (void *into, IOSize n);
   virtual IOSize	read (void *into, IOSize n, IOOffset pos);
   virtual IOSize	readv (IOBuffer *into, IOSize length);
+  virtual IOSize	readv (IOPosBuffer *into, IOSize length);
 
   virtual IOSize	write (const void *from, IOSize n);
   virtual IOSize	write (const void *from, IOSize n, IOOffset pos);
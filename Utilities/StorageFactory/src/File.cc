@@ -1,6 +1,7 @@
 #include "Utilities/StorageFactory/interface/File.h"
 #include "Utilities/StorageFactory/src/SysFile.h"
 #include "Utilities/StorageFactory/src/Throw.h"
+#include "FWCore/Utilities/interface/Exception.h"
 #include <cassert>
 
 using namespace IOFlags;
@@ -236,6 +237,29 @@ IOSize
 File::readv (IOBuffer *into, IOSize length)
 { return IOChannel::readv (into, length); }
 
+/** Read from the file at the given positions.  Uses positioned reads
+    directly instead of seeking for each buffer and restoring the file
+    pointer afterwards, as the generic Storage version does.  */
+IOSize
+File::readv (IOPosBuffer *into, IOSize length)
+{
+  IOSize total = 0;
+  for (IOSize i = 0; i < length; ++i)
+  {
+    try
+    {
+      total += read (into[i].data (), into[i].size (), into[i].offset ());
+    }
+    catch (cms::Exception &)
+    {
+      if (! total)
+	throw;
+      break;
+    }
+  }
+  return total;
+}
+
 /** Write to the file.  */
 IOSize
 File::write (const void *from, IOSize n)
@@ -159,7 +159,7 @@ LocalCacheFile::readv(IOPosBuffer *into, IOSize n)
     cache(start, end);
   }
 
-  return storage_->readv(into, n);
+  return file_->readv(into, n);
 }
 
 IOSize